@@ -1,7 +1,7 @@
-﻿namespace Saladim.Salix.EC;
-
-internal static class SR
-{
-    public static readonly string AddEntityWhileRendering = "Attempt to add entity while rendering.";
-    public static readonly string RemoveEntityWhileRendering = "Attempt to remove entity while rendering.";
-}
+namespace Saladim.Salix.EC;
+
+internal static class SR
+{
+    public static readonly string AddEntityWhileRendering = "Attempt to add entity while rendering.";
+    public static readonly string RemoveEntityWhileRendering = "Attempt to remove entity while rendering.";
+}
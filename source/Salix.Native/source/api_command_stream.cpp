@@ -0,0 +1,156 @@
+#include "api_command_stream.h"
+
+#include <cstring>
+#include <assert.h>
+
+#include "api_graphics.h"
+
+template <typename T>
+static inline T read_payload(const s_byte* payload)
+{
+    T value;
+    memcpy(&value, payload, sizeof(T));
+    return value;
+}
+
+static inline void* to_handle(uint64_t handle)
+{
+    return (void*)(uintptr_t)handle;
+}
+
+static s_bool execute_command(command_op op, const s_byte* payload, uint32_t size)
+{
+    // every payload starts with its fixed part, the variable part is checked against 'size' below
+    switch (op)
+    {
+    case command_op::viewport:
+    {
+        SLX_FAIL_COND(size < sizeof(command_viewport), error_code::command_stream_invalid);
+        command_viewport cmd = read_payload<command_viewport>(payload);
+        return SLX_Viewport(cmd.x, cmd.y, cmd.width, cmd.height);
+    }
+    case command_op::clear:
+    {
+        SLX_FAIL_COND(size < sizeof(command_clear), error_code::command_stream_invalid);
+        command_clear cmd = read_payload<command_clear>(payload);
+        return SLX_Clear(cmd.r, cmd.g, cmd.b, cmd.a);
+    }
+    case command_op::set_shader:
+    case command_op::set_texture:
+    case command_op::set_sampler:
+    {
+        SLX_FAIL_COND(size < sizeof(command_bind), error_code::command_stream_invalid);
+        command_bind cmd = read_payload<command_bind>(payload);
+        if (op == command_op::set_shader)
+            return SLX_SetShader((shader_handle*)to_handle(cmd.handle));
+        if (op == command_op::set_texture)
+            return SLX_SetTexture(cmd.index, to_handle(cmd.handle));
+        return SLX_SetSampler(cmd.index, to_handle(cmd.handle));
+    }
+    case command_op::uniform_int:
+    case command_op::uniform_float:
+    case command_op::uniform_vec4:
+    case command_op::uniform_mat4:
+    case command_op::uniform_mat3x2:
+    {
+        uint32_t count =
+            op == command_op::uniform_vec4 ? 4 :
+            op == command_op::uniform_mat4 ? 16 :
+            op == command_op::uniform_mat3x2 ? 6 : 1;
+        SLX_FAIL_COND(size < sizeof(command_uniform) + count * 4, error_code::command_stream_invalid);
+        command_uniform cmd = read_payload<command_uniform>(payload);
+        shader_handle* shader = (shader_handle*)to_handle(cmd.shader);
+        float values[16];
+        memcpy(values, payload + sizeof(command_uniform), count * 4);
+        switch (op)
+        {
+        case command_op::uniform_int:
+            return SLX_SetShaderParamInt(shader, cmd.location, read_payload<int32_t>(payload + sizeof(command_uniform)));
+        case command_op::uniform_float:
+            return SLX_SetShaderParamFloat(shader, cmd.location, values[0]);
+        case command_op::uniform_vec4:
+            return SLX_SetShaderParamVec4(shader, cmd.location, values);
+        case command_op::uniform_mat4:
+            return SLX_SetShaderParamMat4(shader, cmd.location, values);
+        default:
+            return SLX_SetShaderParamMat3x2(shader, cmd.location, values);
+        }
+    }
+    case command_op::upload_indices:
+    {
+        SLX_FAIL_COND(size < sizeof(command_upload_indices), error_code::command_stream_invalid);
+        command_upload_indices cmd = read_payload<command_upload_indices>(payload);
+        SLX_FAIL_COND(cmd.size < 1 || (uint32_t)cmd.size > size - sizeof(command_upload_indices), error_code::command_stream_invalid);
+        buffer_handle* buffer = (buffer_handle*)to_handle(cmd.buffer);
+        void* data = (void*)(payload + sizeof(command_upload_indices));
+        return SLX_SetIndexBufferData(buffer, data, cmd.size, (VertexBufferDataUsage)cmd.usage, (IndexType)cmd.index_type);
+    }
+    case command_op::upload_vertices:
+    case command_op::upload_instances:
+    {
+        SLX_FAIL_COND(size < sizeof(command_upload), error_code::command_stream_invalid);
+        command_upload cmd = read_payload<command_upload>(payload);
+        SLX_FAIL_COND(cmd.size < 1 || (uint32_t)cmd.size > size - sizeof(command_upload), error_code::command_stream_invalid);
+        buffer_handle* buffer = (buffer_handle*)to_handle(cmd.buffer);
+        void* data = (void*)(payload + sizeof(command_upload));
+        VertexBufferDataUsage usage = (VertexBufferDataUsage)cmd.usage;
+        if (op == command_op::upload_vertices)
+            return SLX_SetVertexBufferData(buffer, data, cmd.size, usage);
+        return SLX_SetInstanceBufferData(buffer, data, cmd.size, usage);
+    }
+    case command_op::draw:
+    case command_op::draw_indexed:
+    {
+        SLX_FAIL_COND(size < sizeof(command_draw), error_code::command_stream_invalid);
+        command_draw cmd = read_payload<command_draw>(payload);
+        SLX_FAIL_COND(cmd.first < 0 || cmd.count < 1, error_code::command_stream_invalid);
+        buffer_handle* buffer = (buffer_handle*)to_handle(cmd.buffer);
+        PrimitiveType primitive = (PrimitiveType)cmd.primitive;
+        if (op == command_op::draw)
+        {
+            return cmd.instances ?
+                SLX_DrawInstanced(buffer, primitive, cmd.first, cmd.count, cmd.instances) :
+                SLX_DrawBufferPrimitives(buffer, primitive, cmd.first, cmd.count);
+        }
+        return cmd.instances ?
+            SLX_DrawIndexedInstanced(buffer, primitive, cmd.first, cmd.count, cmd.base_vertex, cmd.instances) :
+            SLX_DrawIndexedBufferPrimitives(buffer, primitive, cmd.first, cmd.count, cmd.base_vertex);
+    }
+    case command_op::draw_data:
+    {
+        SLX_FAIL_COND(size < sizeof(command_draw_data), error_code::command_stream_invalid);
+        command_draw_data cmd = read_payload<command_draw_data>(payload);
+        SLX_FAIL_COND(cmd.size < 1 || (uint32_t)cmd.size > size - sizeof(command_draw_data), error_code::command_stream_invalid);
+        vertex_type_handle* type = (vertex_type_handle*)to_handle(cmd.vertex_type);
+        return SLX_DrawPrimitives(type, (PrimitiveType)cmd.primitive, (void*)(payload + sizeof(command_draw_data)), cmd.size, cmd.vertices);
+    }
+    }
+    SLX_FAIL(error_code::command_stream_invalid);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SubmitCommandStream(P_IN void* data, int32_t size)
+{
+    SLX_TIMED_CALL();
+
+    assert(data != nullptr);
+    assert(size >= 0);
+
+    SLX_FAIL_COND((size_t)size < sizeof(command_stream_header), error_code::command_stream_invalid);
+    command_stream_header header = read_payload<command_stream_header>((s_byte*)data);
+    SLX_FAIL_COND(header.magic != command_stream_magic, error_code::command_stream_invalid);
+    SLX_FAIL_COND(header.version != command_stream_version, error_code::command_stream_version_unsupported);
+
+    const s_byte* p = (s_byte*)data + sizeof(command_stream_header);
+    const s_byte* end = (s_byte*)data + size;
+    while (p < end)
+    {
+        SLX_FAIL_COND((size_t)(end - p) < sizeof(command_header), error_code::command_stream_invalid);
+        command_header cmd = read_payload<command_header>(p);
+        p += sizeof(command_header);
+        SLX_FAIL_COND((size_t)(end - p) < cmd.size, error_code::command_stream_invalid);
+        if (execute_command(cmd.op, p, cmd.size))
+            return true;
+        p += cmd.size;
+    }
+    return false;
+}
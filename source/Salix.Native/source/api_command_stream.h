@@ -0,0 +1,55 @@
+#pragma once
+#ifndef H_API_COMMAND_STREAM
+#define H_API_COMMAND_STREAM
+
+#include <cstdint>
+#include "common.h"
+#include "error.h"
+
+// ../Salix/Graphics/CommandStream.cs
+// layout: command_stream_header, then commands of command_header + payload, everything 8 bytes aligned.
+// handles are always stored as 64 bits.
+constexpr uint32_t command_stream_magic = 0x43584c53; // "SLXC"
+constexpr uint16_t command_stream_version = 3;
+
+enum class command_op : uint32_t
+{
+    viewport,
+    clear,
+    set_shader,
+    set_texture,
+    set_sampler,
+    uniform_int,
+    uniform_float,
+    uniform_vec4,
+    uniform_mat4,
+    uniform_mat3x2,
+    upload_vertices,
+    upload_indices,
+    upload_instances,
+    draw,
+    draw_indexed,
+    draw_data
+};
+
+struct command_stream_header { uint32_t magic; uint16_t version; uint16_t reserved; };
+// 'size' is the payload size in bytes, already padded
+struct command_header { command_op op; uint32_t size; };
+
+struct command_viewport { int32_t x, y, width, height; };
+struct command_clear { float r, g, b, a; };
+struct command_bind { uint64_t handle; int32_t index; int32_t reserved; };
+// followed by the int32 or float values, count decided by the op
+struct command_uniform { uint64_t shader; int32_t location; int32_t reserved; };
+// followed by 'size' bytes of data
+struct command_upload { uint64_t buffer; int32_t usage; int32_t size; };
+// followed by 'size' bytes of indices
+struct command_upload_indices { uint64_t buffer; int32_t usage; int32_t size; int32_t index_type; int32_t reserved; };
+// instances is 0 for the non instanced draws, 'first' is the first vertex or index, base_vertex is only used by draw_indexed
+struct command_draw { uint64_t buffer; int32_t primitive; int32_t count; int32_t instances; int32_t first; int32_t base_vertex; int32_t reserved; };
+// followed by 'size' bytes of vertices
+struct command_draw_data { uint64_t vertex_type; int32_t primitive; int32_t vertices; int32_t size; int32_t reserved; };
+
+SLX_API s_bool SLX_CALLCONV SLX_SubmitCommandStream(P_IN void* data, int32_t size);
+
+#endif
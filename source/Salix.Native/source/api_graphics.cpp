@@ -1,671 +1,3373 @@
-#include "api_graphics.h"
-
-#include <cstdio>
-#include <assert.h>
-#include <vector>
-
-#include "common.h"
-#include "error.h"
-
-opengl_render_context* current_context;
-
-static error_code gl_error_to_error_code(GLenum glerr);
-
-#ifdef SLX_DEBUG
-
-static const char* gl_error_to_string(GLenum glerr)
-{
-    switch (glerr)
-    {
-    case GL_NO_ERROR: return "GL_NO_ERROR";
-    case GL_INVALID_ENUM: return "GL_INVALID_ENUM";
-    case GL_INVALID_VALUE: return "GL_INVALID_VALUE";
-    case GL_INVALID_FRAMEBUFFER_OPERATION: return "GL_INVALID_FRAMEBUFFER_OPERATION";
-    case GL_OUT_OF_MEMORY: return "GL_OUT_OF_MEMORY";
-    default: return "GL_UNKNOWN_ERROR";
-    }
-}
-
-static void on_gl_error(const char* func, int line, GLenum err)
-{
-    printf("[glError/%s:%d] %s\n", func, line, gl_error_to_string(err));
-}
-
-#define SLX_FAIL_ON_GL_ERROR() { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { \
-    on_gl_error(__FUNCTION__, __LINE__, err); \
-    SLX_FAIL(gl_error_to_error_code(err)); \
-}}
-
-#define SLX_FAIL_ON_GL_ERROR_NULL() { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { \
-    on_gl_error(__FUNCTION__, __LINE__, err); \
-    SLX_FAIL_NULL(gl_error_to_error_code(err)); \
-}}
-
-#define SLX_FAIL_ON_GL_ERROR_RET(ret) { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { \
-    on_gl_error(__FUNCTION__, __LINE__, err); \
-    SLX_FAIL_RET(gl_error_to_error_code(err), ret); \
-}}
-
-#define SLX_FAIL_ON_GL_ERROR_GOTO(label) { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { \
-    on_gl_error(__FUNCTION__, __LINE__, err); \
-    SLX_FAIL_GOTO(gl_error_to_error_code(err), label); \
-}}
-
-#else
-
-#define SLX_FAIL_ON_GL_ERROR() { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { SLX_FAIL(gl_error_to_error_code(err)); }}
-#define SLX_FAIL_ON_GL_ERROR_NULL() { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { SLX_FAIL_NULL(gl_error_to_error_code(err)); }}
-#define SLX_FAIL_ON_GL_ERROR_RET(ret) { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { SLX_FAIL_RET(gl_error_to_error_code(err), ret); }}
-#define SLX_FAIL_ON_GL_ERROR_GOTO(label) { GLenum err; if ((err = glGetError()) != GL_NO_ERROR) { SLX_FAIL_GOTO(gl_error_to_error_code(err), label); }}
-
-#endif // SLX_DEBUG
-
-#define SLX_FAIL_MAPENUM_COND(enum) { if (enum == -1) SLX_FAIL(error_code::enum_mapping_failed); }
-#define SLX_FAIL_MAPENUM_COND_GOTO(enum, label) { if (enum == -1) SLX_FAIL_GOTO(error_code::enum_mapping_failed, label); }
-
-#define pack(glid) ((void*)(size_t)glid)
-#define unpack(ptr) ((GLuint)(size_t)ptr)
-
-#define clear_if_equal(target, value) { if ((target) == (value)) (target) = 0; }
-
-static error_code gl_error_to_error_code(GLenum glerr)
-{
-    switch (glerr)
-    {
-    case GL_NO_ERROR: return error_code::ok;
-    case GL_INVALID_ENUM: return error_code::context_gl_invalid_enum;
-    case GL_INVALID_VALUE: return error_code::context_gl_invalid_value;
-    case GL_INVALID_FRAMEBUFFER_OPERATION: return error_code::context_gl_invalid_framebuffer_operation;
-    case GL_OUT_OF_MEMORY: return error_code::context_gl_out_of_memory;
-    default: return error_code::context_gl_unknown_error;
-    }
-}
-
-static s_bool ensure_vao(GLuint vao)
-{
-    if (current_context->current_vao != vao)
-    {
-        glBindVertexArray(vao);
-        SLX_FAIL_ON_GL_ERROR();
-        current_context->current_vao = vao;
-    }
-    return false;
-}
-
-static s_bool ensure_vbo(GLuint vbo)
-{
-    if (current_context->current_vbo != vbo)
-    {
-        glBindBuffer(GL_ARRAY_BUFFER, vbo);
-        SLX_FAIL_ON_GL_ERROR();
-        current_context->current_vbo = vbo;
-    }
-    return false;
-}
-
-static s_bool ensure_texture(GLuint tex)
-{
-    if (current_context->current_texture != tex)
-    {
-        glBindTexture(GL_TEXTURE_2D, tex);
-        SLX_FAIL_ON_GL_ERROR();
-        current_context->current_texture = tex;
-    }
-    return false;
-}
-
-static s_bool ensure_shader(GLuint shd)
-{
-    if (current_context->current_shader != shd)
-    {
-        glUseProgram(shd);
-        SLX_FAIL_ON_GL_ERROR();
-        current_context->current_shader = shd;
-    }
-    return false;
-}
-
-// TODO ensure expected bindings (shaders, textures, samplers...)
-static s_bool apply_expected_state()
-{
-    if (ensure_texture(current_context->expected_texture))
-        return true;
-    if (ensure_shader(current_context->expected_shader))
-        return true;
-
-    return false;
-}
-
-static s_bool make_vao(VertexElementType* type, int32_t len, P_OUT GLuint* out_vao)
-{
-    assert(type != 0);
-    assert(len > 0);
-    assert(out_vao != 0);
-    assert(current_context->current_vbo != 0);
-
-    GLuint vao = 0;
-    glGenVertexArrays(1, &vao);
-    glBindVertexArray(vao);
-    current_context->current_vao = vao;
-
-    int vertexSize = 0;
-    for (int i = 0; i < len; i++)
-    {
-        vertex_element_glinfo t = VertexElementType_get_glinfo(type[i]);
-        SLX_FAIL_COND_GOTO(t.type == 0, error_code::enum_mapping_failed, err);
-        vertexSize += t.componentSize * t.count;
-    }
-
-    s_byte* currentOffset = 0;
-    for (int i = 0; i < len; i++)
-    {
-        vertex_element_glinfo t = VertexElementType_get_glinfo(type[i]);
-        glVertexAttribPointer(i, t.count, t.type, GL_FALSE, vertexSize, (void*)currentOffset);
-        SLX_FAIL_ON_GL_ERROR_GOTO(err);
-        glEnableVertexAttribArray(i);
-        SLX_FAIL_ON_GL_ERROR_GOTO(err);
-        currentOffset += (size_t)(t.componentSize * t.count);
-    }
-    *out_vao = vao;
-    return false;
-err:
-    if (vao)
-    {
-        glDeleteVertexArrays(1, &vao);
-        glBindVertexArray(0);
-        current_context->current_vao = 0;
-    }
-    return true;
-}
-
-// TODO: move these to managed
-void graphics_initialize()
-{
-    glGenBuffers(1, &current_context->default_vbo);
-    glEnable(GL_BLEND);
-    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_QueryDeviceInfo(P_OUT render_context_info* out_render_context_info)
-{
-    assert(out_render_context_info != nullptr);
-
-    glGetIntegerv(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, &out_render_context_info->max_textures);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_Viewport(int32_t x, int32_t y, int32_t width, int32_t height)
-{
-    assert(x >= 0 && y >= 0 && width >= 1 && height >= 1);
-
-    glViewport(x, y, width, height);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_Clear(float r, float g, float b, float a)
-{
-    assert(r >= 0.0f && g >= 0.0f && b >= 0.0f && a >= 0.0f);
-
-    glClearColor(r, g, b, a);
-    glClear(GL_COLOR_BUFFER_BIT);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API void* SLX_CALLCONV SLX_RegisterVertexType(P_IN VertexElementType* type, int32_t len)
-{
-    assert(type != nullptr);
-    assert(len > 0);
-
-    VertexElementType* tptr = new VertexElementType[len];
-    memcpy(tptr, type, len * sizeof(VertexElementType));
-    vertex_type_handle* h = new vertex_type_handle();
-    h->type_ptr = tptr;
-    h->length = len;
-    h->default_vao = 0;
-    return h;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DrawPrimitives(
-    P_IN vertex_type_handle* vertex_type,
-    PrimitiveType pt,
-    void* data, int32_t data_size,
-    int32_t vertices_to_draw
-)
-{
-    assert(vertex_type != nullptr);
-    assert(data != 0);
-    assert(data_size >= 1);
-    assert(vertices_to_draw >= 1);
-
-    if (apply_expected_state()) return true;
-
-    if (ensure_vbo(current_context->default_vbo)) return true;
-
-    if (vertex_type->default_vao == 0)
-        if (make_vao(vertex_type->type_ptr, vertex_type->length, &vertex_type->default_vao))
-            return true;
-    if (ensure_vao(vertex_type->default_vao)) return true;
-
-    glBufferData(GL_ARRAY_BUFFER, data_size, data, GL_DYNAMIC_DRAW);
-    SLX_FAIL_ON_GL_ERROR();
-    glDrawArrays(PrimitiveType_get_glinfo(pt), 0, vertices_to_draw);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API buffer_handle* SLX_CALLCONV SLX_CreateVertexBuffer(P_IN vertex_type_handle* vertex_type, s_bool use_ibo)
-{
-    assert(vertex_type != nullptr);
-    assert(use_ibo == 0 || use_ibo == 1);
-
-    GLuint id;
-    glGenBuffers(1, &id);
-    ensure_vbo(id);
-    buffer_handle* h = new buffer_handle();
-    h->vbo = id;
-
-    if (make_vao(vertex_type->type_ptr, vertex_type->length, &h->vao))
-    {
-        glDeleteBuffers(1, &id);
-        return nullptr;
-    }
-
-    h->ibo = 0;
-    if (use_ibo)
-    {
-        glGenBuffers(1, &h->ibo);
-        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, h->ibo);
-        SLX_FAIL_ON_GL_ERROR_NULL();
-    }
-    return h;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DeleteVertexBuffer(P_IN buffer_handle* buffer)
-{
-    assert(buffer != nullptr);
-
-    glDeleteVertexArrays(1, &buffer->vao);
-    SLX_FAIL_ON_GL_ERROR();
-    glDeleteBuffers(1, &buffer->vbo);
-    SLX_FAIL_ON_GL_ERROR();
-    if (buffer->ibo)
-    {
-        glDeleteBuffers(1, &buffer->ibo);
-        SLX_FAIL_ON_GL_ERROR();
-    }
-    clear_if_equal(current_context->current_vao, buffer->vao);
-    clear_if_equal(current_context->current_vbo, buffer->vbo);
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetVertexBufferData(buffer_handle* buffer, void* data, int32_t dataSize, VertexBufferDataUsage data_usage)
-{
-    assert(buffer != nullptr);
-    assert(data != nullptr);
-    assert(dataSize >= 1);
-
-    if (ensure_vbo(buffer->vbo)) return true;
-    if (ensure_vao(buffer->vao)) return true;
-    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
-    SLX_FAIL_MAPENUM_COND(usage);
-    glBufferData(GL_ARRAY_BUFFER, dataSize, data, usage);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DrawBufferPrimitives(buffer_handle* buffer, PrimitiveType primitiveType, int32_t verticesCount)
-{
-    assert(buffer != nullptr);
-    assert(verticesCount >= 1);
-
-    if (apply_expected_state()) return true;
-
-    if (ensure_vbo(buffer->vbo)) return true;
-    if (ensure_vao(buffer->vao)) return true;
-    GLenum type = PrimitiveType_get_glinfo(primitiveType);
-    SLX_FAIL_MAPENUM_COND(type);
-    glDrawArrays(type, 0, verticesCount);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetIndexBufferData(buffer_handle* buffer, void* data, int32_t dataSize, VertexBufferDataUsage data_usage)
-{
-    assert(buffer != nullptr);
-    assert(buffer->ibo != 0);
-
-    if (ensure_vao(buffer->vao)) return true;
-    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
-    SLX_FAIL_MAPENUM_COND(usage);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, usage);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedBufferPrimitives(buffer_handle* buffer, PrimitiveType primitiveType, int32_t verticesCount)
-{
-    assert(buffer != nullptr);
-    assert(verticesCount >= 1);
-
-    if (apply_expected_state()) return true;
-
-    if (ensure_vbo(buffer->vbo)) return true;
-    if (ensure_vao(buffer->vao)) return true;
-    GLenum type = PrimitiveType_get_glinfo(primitiveType);
-    SLX_FAIL_MAPENUM_COND(type);
-    glDrawElements(type, verticesCount, GL_UNSIGNED_SHORT, 0);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API void* SLX_CALLCONV SLX_CreateTexture(int32_t width, int32_t height)
-{
-    assert(width >= 1);
-    assert(height >= 1);
-
-    GLuint tex;
-    glGenTextures(1, &tex);
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-    return pack(tex);
-
-failed:
-    if (tex) glDeleteTextures(1, &tex);
-    return nullptr;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetTextureFilter(void* tex_handle, TextureFilterType min, TextureFilterType max)
-{
-    assert(tex_handle != nullptr);
-
-    GLuint tex = unpack(tex_handle);
-    if (ensure_texture(tex))
-        return true;
-    GLenum typeMin = TextureFilterType_to_gl(min);
-    GLenum typeMax = TextureFilterType_to_gl(max);
-    SLX_FAIL_MAPENUM_COND(typeMin);
-    SLX_FAIL_MAPENUM_COND(typeMax);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, typeMin);
-    SLX_FAIL_ON_GL_ERROR();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, typeMax);
-    SLX_FAIL_ON_GL_ERROR();
-
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetTextureWrap(void* tex_handle, TextureWrapType wrap)
-{
-    assert(tex_handle != nullptr);
-
-    GLuint tex = unpack(tex_handle);
-    if (ensure_texture(tex))
-        return true;
-    GLenum type = TextureWrapType_to_gl(wrap);
-    SLX_FAIL_MAPENUM_COND(type);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, type);
-    SLX_FAIL_ON_GL_ERROR();
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, type);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-// TODO support more other formats
-SLX_API s_bool SLX_CALLCONV SLX_SetTextureData(void* tex_handle, int32_t width, int32_t height, void* data, ImageFormat imageFormat)
-{
-    assert(tex_handle != nullptr);
-    assert(width >= 1);
-    assert(height >= 1);
-    assert(data != nullptr);
-
-    GLuint tex = unpack(tex_handle);
-    if (ensure_texture(tex))
-        return true;
-    int lineWidth = (width * ImageFormat_get_size(imageFormat));
-    int align = lineWidth % 8 == 0 ? 8 : lineWidth % 4 == 0 ? 4 : lineWidth % 2 == 0 ? 2 : 1;
-    glPixelStorei(GL_UNPACK_ALIGNMENT, align);
-    GLenum format = ImageFormat_to_gl(imageFormat);
-    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DeleteTexture(void* tex_handle)
-{
-    assert(tex_handle != nullptr);
-
-    GLuint tex = unpack(tex_handle);
-    glDeleteTextures(1, &tex);
-    SLX_FAIL_ON_GL_ERROR();
-    clear_if_equal(current_context->current_texture, tex);
-    clear_if_equal(current_context->expected_texture, tex);
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetTexture(int32_t index, void* tex_handle)
-{
-    assert(index >= 0);
-    assert(tex_handle != nullptr);
-
-    ensure_texture(current_context->expected_texture);
-    GLuint tex = unpack(tex_handle);
-    glActiveTexture(GL_TEXTURE0 + index);
-    SLX_FAIL_ON_GL_ERROR();
-    current_context->expected_texture = tex;
-    ensure_texture(current_context->expected_texture);
-    return false;
-}
-
-SLX_API void* SLX_CALLCONV SLX_CreateShaderFromGlsl(const char* vert_source, const char* frag_source)
-{
-    assert(vert_source != nullptr);
-    assert(frag_source != nullptr);
-
-    GLuint vsh = glCreateShader(GL_VERTEX_SHADER);
-    GLuint fsh = glCreateShader(GL_FRAGMENT_SHADER);
-    glShaderSource(vsh, 1, &vert_source, nullptr);
-    glShaderSource(fsh, 1, &frag_source, nullptr);
-    // TODO report the compile result
-    glCompileShader(vsh);
-    glCompileShader(fsh);
-    GLuint prog = glCreateProgram();
-    glAttachShader(prog, vsh);
-    glAttachShader(prog, fsh);
-    glLinkProgram(prog);
-    glDeleteShader(vsh);
-    glDeleteShader(fsh);
-    SLX_FAIL_ON_GL_ERROR_NULL();
-    return pack(prog);
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DeleteShader(void* shader_handle)
-{
-    assert(shader_handle != 0);
-
-    GLuint prog = unpack(shader_handle);
-    glDeleteProgram(prog);
-    SLX_FAIL_ON_GL_ERROR();
-    clear_if_equal(current_context->current_shader, prog);
-    clear_if_equal(current_context->expected_shader, prog);
-
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetShader(void* shader_handle)
-{
-    // 0 to use default render pipeline
-    GLuint prog = unpack(shader_handle);
-    ensure_shader(prog);
-    current_context->expected_shader = prog;
-    return false;
-}
-
-SLX_API void* SLX_CALLCONV SLX_CreateSampler(TextureFilterType filter_type, TextureWrapType wrap_type)
-{
-    GLuint sampler = 0;
-    glGenSamplers(1, &sampler);
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-
-    GLenum filter = TextureFilterType_to_gl(filter_type);
-    SLX_FAIL_MAPENUM_COND_GOTO(filter, failed);
-    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, filter);
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, filter);
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-
-    GLenum wrap = TextureWrapType_to_gl(wrap_type);
-    SLX_FAIL_MAPENUM_COND_GOTO(wrap, failed);
-    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, wrap);
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, wrap);
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-
-    return pack(sampler);
-failed:
-    if (sampler) glDeleteSamplers(1, &sampler);
-    return nullptr;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetSampler(int32_t index, void* sampler_handle)
-{
-    assert(sampler_handle != nullptr);
-
-    glBindSampler(index, unpack(sampler_handle));
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-// TODO
-SLX_API s_bool SLX_CALLCONV SLX_DeleteSampler(void* sampler_handle)
-{
-    assert(sampler_handle != nullptr);
-
-    GLuint sampler = unpack(sampler_handle);
-    glDeleteSamplers(1, &sampler);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-#pragma region uniform
-
-SLX_API int SLX_CALLCONV SLX_GetShaderParamLocation(void* shader_handle, const char* name_utf8)
-{
-    assert(shader_handle != nullptr);
-
-    int ret = glGetUniformLocation(unpack(shader_handle), name_utf8);
-    SLX_FAIL_ON_GL_ERROR_RET(-2);
-    return ret;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamInt(void* shader_handle, int32_t loc, int32_t value)
-{
-    assert(loc != -1);
-
-    GLuint prog = unpack(shader_handle);
-    ensure_shader(prog);
-    glUniform1i(loc, value);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamFloat(void* shader_handle, int32_t loc, float value)
-{
-    assert(loc != -1);
-
-    GLuint prog = unpack(shader_handle);
-    ensure_shader(prog);
-    glUniform1f(loc, value);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamVec4(void* shader_handle, int32_t loc, P_IN float* vec)
-{
-    assert(loc != -1);
-
-    GLuint prog = unpack(shader_handle);
-    ensure_shader(prog);
-    glUniform4fv(loc, 1, vec);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat4(void* shader_handle, int32_t loc, P_IN float* mat)
-{
-    assert(loc != -1);
-
-    GLuint prog = unpack(shader_handle);
-    ensure_shader(prog);
-    glUniformMatrix4fv(loc, 1, true, mat);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat3x2(void* shader_handle, int32_t loc, P_IN float* mat)
-{
-    assert(loc != -1);
-
-    GLuint prog = unpack(shader_handle);
-    ensure_shader(prog);
-    glUniformMatrix3x2fv(loc, 1, false, mat);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
-}
-
-#pragma endregion
-
-SLX_API void* SLX_CALLCONV SLX_CreateRenderTarget(void* tex_handle)
-{
-    assert(tex_handle != nullptr);
-
-    error_code error_code = error_code::ok;
-
-    unsigned int fbo;
-    glGenFramebuffers(1, &fbo);
-
-    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, unpack(tex_handle), 0);
-
-    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
-    glBindFramebuffer(GL_FRAMEBUFFER, current_context->current_fbo);
-
-    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
-    {
-        error_code = error_code::gl_framebuffer_not_complete;
-        goto failed;
-    }
-
-    return pack(fbo);
-failed:
-    if (fbo)
-        glDeleteFramebuffers(1, &fbo);
-    glBindFramebuffer(GL_FRAMEBUFFER, current_context->current_fbo);
-    return nullptr;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_SetRenderTarget(void* fbo_handle)
-{
-    assert(fbo_handle != nullptr);
-
-    GLuint fbo = unpack(fbo_handle);
-    if (current_context->current_fbo != fbo)
-    {
-        // no need to check wheather it's equals to 0
-        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
-        SLX_FAIL_ON_GL_ERROR();
-        current_context->current_fbo = fbo;
-    }
-    return false;
-}
-
-SLX_API s_bool SLX_CALLCONV SLX_DeleteRenderTarget(void* fbo_handle)
-{
-    assert(fbo_handle != nullptr);
-
-    GLuint fbo = unpack(fbo_handle);
-    assert(fbo != 0);
-    glDeleteFramebuffers(1, &fbo);
-    SLX_FAIL_ON_GL_ERROR();
-    return false;
+#include "api_graphics.h"
+
+#include <cstddef>
+#include <cstdio>
+#include <cmath>
+#include <cstring>
+#include <cwchar>
+#include <assert.h>
+#include <vector>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define SLX_SPRITE_SSE
+#include <xmmintrin.h>
+#endif
+
+#include "common.h"
+#include "error.h"
+
+opengl_render_context* current_context;
+
+static error_code gl_error_to_error_code(GLenum glerr);
+
+#ifdef SLX_DEBUG
+
+static const char* gl_error_to_string(GLenum glerr)
+{
+    switch (glerr)
+    {
+    case GL_NO_ERROR: return "GL_NO_ERROR";
+    case GL_INVALID_ENUM: return "GL_INVALID_ENUM";
+    case GL_INVALID_VALUE: return "GL_INVALID_VALUE";
+    case GL_INVALID_FRAMEBUFFER_OPERATION: return "GL_INVALID_FRAMEBUFFER_OPERATION";
+    case GL_OUT_OF_MEMORY: return "GL_OUT_OF_MEMORY";
+    default: return "GL_UNKNOWN_ERROR";
+    }
+}
+
+#endif // SLX_DEBUG
+
+// returns whether the SLX call fails, while locating for the per-frame policy it only records the site
+static s_bool on_gl_error(const char* func, int line, GLenum err)
+{
+#ifdef SLX_DEBUG
+    printf("[glError/%s:%d] %s\n", func, line, gl_error_to_string(err));
+#endif
+    if (!current_context->locating_gl_error)
+        return true;
+    gl_error_report& report = current_context->gl_error;
+    if (report.code == error_code::ok)
+    {
+        report.code = gl_error_to_error_code(err);
+        report.function = func;
+        report.line = line;
+    }
+    return false;
+}
+
+// checks nothing unless the error policy of the context asks for it
+#define SLX_GL_ERROR_CHECK(fail) { GLenum err; \
+    if (current_context->check_gl_errors && (current_context->frame.gl_error_checks++, err = glGetError()) != GL_NO_ERROR && on_gl_error(__FUNCTION__, __LINE__, err)) { \
+    fail; \
+}}
+
+#define SLX_FAIL_ON_GL_ERROR() SLX_GL_ERROR_CHECK(SLX_FAIL(gl_error_to_error_code(err)))
+#define SLX_FAIL_ON_GL_ERROR_NULL() SLX_GL_ERROR_CHECK(SLX_FAIL_NULL(gl_error_to_error_code(err)))
+#define SLX_FAIL_ON_GL_ERROR_RET(ret) SLX_GL_ERROR_CHECK(SLX_FAIL_RET(gl_error_to_error_code(err), ret))
+#define SLX_FAIL_ON_GL_ERROR_GOTO(label) SLX_GL_ERROR_CHECK(SLX_FAIL_GOTO(gl_error_to_error_code(err), label))
+
+#define SLX_FAIL_MAPENUM_COND(enum) { if (enum == -1) SLX_FAIL(error_code::enum_mapping_failed); }
+#define SLX_FAIL_MAPENUM_COND_NULL(enum) { if (enum == -1) SLX_FAIL_NULL(error_code::enum_mapping_failed); }
+#define SLX_FAIL_MAPENUM_COND_RET(enum, ret) { if (enum == -1) SLX_FAIL_RET(error_code::enum_mapping_failed, ret); }
+#define SLX_FAIL_MAPENUM_COND_GOTO(enum, label) { if (enum == -1) SLX_FAIL_GOTO(error_code::enum_mapping_failed, label); }
+
+#define pack(glid) ((void*)(size_t)glid)
+#define unpack(ptr) ((GLuint)(size_t)ptr)
+
+#define clear_if_equal(target, value) { if ((target) == (value)) (target) = 0; }
+
+static error_code gl_error_to_error_code(GLenum glerr)
+{
+    switch (glerr)
+    {
+    case GL_NO_ERROR: return error_code::ok;
+    case GL_INVALID_ENUM: return error_code::context_gl_invalid_enum;
+    case GL_INVALID_VALUE: return error_code::context_gl_invalid_value;
+    case GL_INVALID_FRAMEBUFFER_OPERATION: return error_code::context_gl_invalid_framebuffer_operation;
+    case GL_OUT_OF_MEMORY: return error_code::context_gl_out_of_memory;
+    default: return error_code::context_gl_unknown_error;
+    }
+}
+
+// each bind is counted in the lifetime totals and under its kind for the frame
+static inline void count_bind_issued(bind_stats frame_stats::* kind)
+{
+    current_context->stats.issued++;
+    (current_context->frame.*kind).issued++;
+}
+
+static inline void count_bind_skipped(bind_stats frame_stats::* kind)
+{
+    current_context->stats.skipped++;
+    (current_context->frame.*kind).skipped++;
+}
+
+static inline void count_draw(int64_t vertices, int64_t indices, int64_t instances)
+{
+    frame_stats& frame = current_context->frame;
+    frame.draws++;
+    frame.vertices += vertices * instances;
+    frame.indices += indices * instances;
+}
+
+static s_bool ensure_vao(GLuint vao)
+{
+    if (current_context->current_vao == vao)
+    {
+        count_bind_skipped(&frame_stats::vao_binds);
+        return false;
+    }
+    glBindVertexArray(vao);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_vao = vao;
+    current_context->current_ibo = unknown_binding;
+    count_bind_issued(&frame_stats::vao_binds);
+    return false;
+}
+
+static s_bool ensure_vbo(GLuint vbo)
+{
+    if (current_context->current_vbo == vbo)
+    {
+        count_bind_skipped(&frame_stats::other_binds);
+        return false;
+    }
+    glBindBuffer(GL_ARRAY_BUFFER, vbo);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_vbo = vbo;
+    count_bind_issued(&frame_stats::other_binds);
+    return false;
+}
+
+// binds into the current vao
+static s_bool ensure_ibo(GLuint ibo)
+{
+    if (current_context->current_ibo == ibo)
+    {
+        count_bind_skipped(&frame_stats::other_binds);
+        return false;
+    }
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_ibo = ibo;
+    count_bind_issued(&frame_stats::other_binds);
+    return false;
+}
+
+// the generic uniform buffer target, only for uploads
+static s_bool ensure_ubo(GLuint ubo)
+{
+    if (current_context->current_ubo == ubo)
+    {
+        count_bind_skipped(&frame_stats::other_binds);
+        return false;
+    }
+    glBindBuffer(GL_UNIFORM_BUFFER, ubo);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_ubo = ubo;
+    count_bind_issued(&frame_stats::other_binds);
+    return false;
+}
+
+static s_bool ensure_uniform_buffer(GLuint binding, GLuint ubo)
+{
+    if (current_context->current_uniform_buffers[binding] == ubo)
+    {
+        count_bind_skipped(&frame_stats::other_binds);
+        return false;
+    }
+    glBindBufferBase(GL_UNIFORM_BUFFER, binding, ubo);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_uniform_buffers[binding] = ubo;
+    current_context->current_ubo = ubo;
+    count_bind_issued(&frame_stats::other_binds);
+    return false;
+}
+
+static s_bool ensure_active_unit(GLuint unit)
+{
+    assert(unit < max_texture_units);
+
+    if (current_context->active_unit == unit)
+    {
+        count_bind_skipped(&frame_stats::texture_binds);
+        return false;
+    }
+    glActiveTexture(GL_TEXTURE0 + unit);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->active_unit = unit;
+    count_bind_issued(&frame_stats::texture_binds);
+    return false;
+}
+
+// binds to the active unit, also used to edit textures
+static s_bool ensure_texture(GLuint tex)
+{
+    GLuint& bound = current_context->current_textures[current_context->active_unit];
+    if (bound == tex)
+    {
+        count_bind_skipped(&frame_stats::texture_binds);
+        return false;
+    }
+    glBindTexture(GL_TEXTURE_2D, tex);
+    SLX_FAIL_ON_GL_ERROR();
+    bound = tex;
+    count_bind_issued(&frame_stats::texture_binds);
+    return false;
+}
+
+// binds to the active unit, also used to edit texture arrays
+static s_bool ensure_texture_array(GLuint tex)
+{
+    GLuint& bound = current_context->current_texture_arrays[current_context->active_unit];
+    if (bound == tex)
+    {
+        count_bind_skipped(&frame_stats::texture_binds);
+        return false;
+    }
+    glBindTexture(GL_TEXTURE_2D_ARRAY, tex);
+    SLX_FAIL_ON_GL_ERROR();
+    bound = tex;
+    count_bind_issued(&frame_stats::texture_binds);
+    return false;
+}
+
+static s_bool ensure_texture_array_unit(GLuint unit, GLuint tex)
+{
+    if (current_context->current_texture_arrays[unit] == tex)
+    {
+        count_bind_skipped(&frame_stats::texture_binds);
+        return false;
+    }
+    if (ensure_active_unit(unit))
+        return true;
+    return ensure_texture_array(tex);
+}
+
+static s_bool ensure_texture_unit(GLuint unit, GLuint tex)
+{
+    // checked before switching units so matching units cost no gl call at all
+    if (current_context->current_textures[unit] == tex)
+    {
+        count_bind_skipped(&frame_stats::texture_binds);
+        return false;
+    }
+    if (ensure_active_unit(unit))
+        return true;
+    return ensure_texture(tex);
+}
+
+static s_bool ensure_sampler(GLuint unit, GLuint sampler)
+{
+    assert(unit < max_texture_units);
+
+    if (current_context->current_samplers[unit] == sampler)
+    {
+        count_bind_skipped(&frame_stats::other_binds);
+        return false;
+    }
+    glBindSampler(unit, sampler);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_samplers[unit] = sampler;
+    count_bind_issued(&frame_stats::other_binds);
+    return false;
+}
+
+static s_bool ensure_shader(GLuint shd)
+{
+    if (current_context->current_shader == shd)
+    {
+        count_bind_skipped(&frame_stats::shader_binds);
+        return false;
+    }
+    glUseProgram(shd);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->current_shader = shd;
+    count_bind_issued(&frame_stats::shader_binds);
+    return false;
+}
+
+static s_bool ensure_blend(s_bool enabled, GLenum src, GLenum dst)
+{
+    opengl_render_context* ctx = current_context;
+    if (ctx->blend_enabled != enabled)
+    {
+        if (enabled)
+            glEnable(GL_BLEND);
+        else
+            glDisable(GL_BLEND);
+        ctx->blend_enabled = enabled;
+        count_bind_issued(&frame_stats::other_binds);
+    }
+    else
+        count_bind_skipped(&frame_stats::other_binds);
+
+    if (ctx->blend_src != src || ctx->blend_dst != dst)
+    {
+        glBlendFunc(src, dst);
+        ctx->blend_src = src;
+        ctx->blend_dst = dst;
+        count_bind_issued(&frame_stats::other_binds);
+    }
+    else
+        count_bind_skipped(&frame_stats::other_binds);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+static s_bool ensure_viewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    int32_t* v = current_context->viewport;
+    if (v[0] == x && v[1] == y && v[2] == width && v[3] == height)
+    {
+        count_bind_skipped(&frame_stats::other_binds);
+        return false;
+    }
+    glViewport(x, y, width, height);
+    SLX_FAIL_ON_GL_ERROR();
+    v[0] = x; v[1] = y; v[2] = width; v[3] = height;
+    count_bind_issued(&frame_stats::other_binds);
+    return false;
+}
+
+static void set_expected_texture(GLuint unit, GLuint tex)
+{
+    assert(unit < max_texture_units);
+
+    current_context->expected_textures[unit] = tex;
+    if (unit >= current_context->expected_units)
+        current_context->expected_units = unit + 1;
+}
+
+static void set_expected_texture_array(GLuint unit, GLuint tex)
+{
+    assert(unit < max_texture_units);
+
+    current_context->expected_texture_arrays[unit] = tex;
+    if (unit >= current_context->expected_units)
+        current_context->expected_units = unit + 1;
+}
+
+// TODO ensure expected samplers
+static s_bool apply_expected_state()
+{
+    for (GLuint unit = 0; unit < current_context->expected_units; unit++)
+    {
+        if (ensure_texture_unit(unit, current_context->expected_textures[unit]))
+            return true;
+        if (ensure_texture_array_unit(unit, current_context->expected_texture_arrays[unit]))
+            return true;
+    }
+    if (ensure_shader(current_context->expected_shader))
+        return true;
+
+    return false;
+}
+
+// points the attributes [first, first + count) at the currently bound array buffer
+static s_bool set_vertex_attributes(VertexElementType* type, int32_t first, int32_t count, GLuint divisor)
+{
+    int vertexSize = 0;
+    for (int i = first; i < first + count; i++)
+    {
+        vertex_element_glinfo t = VertexElementType_get_glinfo(type[i]);
+        SLX_FAIL_COND(t.type == 0, error_code::enum_mapping_failed);
+        vertexSize += t.componentSize * t.count;
+    }
+
+    s_byte* currentOffset = 0;
+    for (int i = first; i < first + count; i++)
+    {
+        vertex_element_glinfo t = VertexElementType_get_glinfo(type[i]);
+        glVertexAttribPointer(i, t.count, t.type, GL_FALSE, vertexSize, (void*)currentOffset);
+        SLX_FAIL_ON_GL_ERROR();
+        glEnableVertexAttribArray(i);
+        SLX_FAIL_ON_GL_ERROR();
+        if (divisor)
+        {
+            glVertexAttribDivisor(i, divisor);
+            SLX_FAIL_ON_GL_ERROR();
+        }
+        currentOffset += (size_t)(t.componentSize * t.count);
+    }
+    return false;
+}
+
+// the last 'instance_len' attributes are read once per instance from 'instance_vbo'
+static s_bool make_vao(VertexElementType* type, int32_t len, int32_t instance_len, GLuint instance_vbo, P_OUT GLuint* out_vao)
+{
+    assert(type != 0);
+    assert(len > 0);
+    assert(instance_len >= 0 && instance_len < len);
+    assert(instance_len == 0 || instance_vbo != 0);
+    assert(out_vao != 0);
+    assert(current_context->current_vbo != 0);
+
+    GLuint vao = 0;
+    glGenVertexArrays(1, &vao);
+    glBindVertexArray(vao);
+    current_context->current_vao = vao;
+    current_context->current_ibo = 0;
+    count_bind_issued(&frame_stats::vao_binds);
+
+    if (set_vertex_attributes(type, 0, len - instance_len, 0))
+        goto err;
+    if (instance_len)
+    {
+        if (ensure_vbo(instance_vbo))
+            goto err;
+        if (set_vertex_attributes(type, len - instance_len, instance_len, 1))
+            goto err;
+    }
+    *out_vao = vao;
+    return false;
+err:
+    if (vao)
+    {
+        glDeleteVertexArrays(1, &vao);
+        glBindVertexArray(0);
+        current_context->current_vao = 0;
+        current_context->current_ibo = unknown_binding;
+    }
+    return true;
+}
+
+#pragma region error policy
+
+static void SLX_CALLCONV gl_error_report_callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, const GLchar* msg, const void* user_param)
+{
+    if (type != GL_DEBUG_TYPE_ERROR_ARB)
+        return;
+    gl_error_report& report = ((opengl_render_context*)user_param)->gl_error;
+#ifdef SLX_DEBUG
+    fprintf(stderr, "[glError] %s\n", msg);
+#endif
+    if (report.code != error_code::ok)
+        return;
+    report.code = error_code::graphics_api_error;
+    report.function = nullptr;
+    report.line = 0;
+    if (length <= 0)
+        length = (GLsizei)strlen(msg);
+    if (length >= (GLsizei)sizeof(report.message))
+        length = sizeof(report.message) - 1;
+    memcpy(report.message, msg, length);
+    report.message[length] = '\0';
+}
+
+// the per-frame policy, the frame after an error is polled per call and reported at its end
+static void check_frame_gl_errors()
+{
+    opengl_render_context* rc = current_context;
+    GLenum first = glGetError();
+    rc->frame.gl_error_checks++;
+    // drain every flag so the next frame starts clean
+    for (GLenum err = first; err != GL_NO_ERROR; err = glGetError())
+        rc->frame.gl_error_checks++;
+
+    if (rc->locating_gl_error)
+    {
+        // not reproduced, only the frame is known
+        if (rc->gl_error.code == error_code::ok)
+        {
+            rc->gl_error.code = rc->pending_gl_error;
+            rc->gl_error.function = nullptr;
+            rc->gl_error.line = 0;
+        }
+        rc->locating_gl_error = false;
+        rc->check_gl_errors = false;
+    }
+    else if (first != GL_NO_ERROR)
+    {
+        rc->pending_gl_error = gl_error_to_error_code(first);
+        rc->locating_gl_error = true;
+        rc->check_gl_errors = true;
+    }
+}
+
+#pragma endregion
+
+// TODO: move these to managed
+void graphics_initialize(gl_error_policy error_policy)
+{
+    current_context->error_policy = error_policy;
+    current_context->check_gl_errors = error_policy == gl_error_policy::per_call;
+    // synchronous, so the callback runs on this thread and can't race SLX_GetGLErrorReport
+    if (error_policy == gl_error_policy::debug_callback)
+    {
+        glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS_ARB);
+        glDebugMessageCallbackARB(gl_error_report_callback, current_context);
+    }
+
+    current_context->profiler.result_info.frame = -1;
+    ensure_blend(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GetGLErrorReport(P_OUT gl_error_report* out_report)
+{
+    assert(out_report != nullptr);
+
+    *out_report = current_context->gl_error;
+    current_context->gl_error = gl_error_report();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_QueryDeviceInfo(P_OUT render_context_info* out_render_context_info)
+{
+    SLX_TIMED_CALL();
+
+    assert(out_render_context_info != nullptr);
+
+    glGetIntegerv(GL_MAX_VERTEX_TEXTURE_IMAGE_UNITS, &out_render_context_info->max_textures);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_QueryBindStats(P_OUT bind_stats* out_stats)
+{
+    assert(out_stats != nullptr);
+
+    *out_stats = current_context->stats;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_QueryUniformStats(P_OUT uniform_stats* out_stats)
+{
+    assert(out_stats != nullptr);
+
+    *out_stats = current_context->uniform_uploads;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GetFrameStats(P_OUT frame_stats* out_stats, s_bool reset)
+{
+    assert(out_stats != nullptr);
+
+    *out_stats = current_context->frame;
+    if (reset)
+        current_context->frame = frame_stats();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_Viewport(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+    SLX_TIMED_CALL();
+
+    assert(x >= 0 && y >= 0 && width >= 1 && height >= 1);
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    return ensure_viewport(x, y, width, height);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_Clear(float r, float g, float b, float a)
+{
+    SLX_TIMED_CALL();
+
+    assert(r >= 0.0f && g >= 0.0f && b >= 0.0f && a >= 0.0f);
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    glClearColor(r, g, b, a);
+    glClear(GL_COLOR_BUFFER_BIT);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API void* SLX_CALLCONV SLX_RegisterVertexType(P_IN VertexElementType* type, int32_t len, int32_t instance_len)
+{
+    SLX_TIMED_CALL();
+
+    assert(type != nullptr);
+    assert(len > 0);
+    assert(instance_len >= 0 && instance_len < len);
+
+    int stride = 0;
+    int instance_stride = 0;
+    for (int i = 0; i < len; i++)
+    {
+        vertex_element_glinfo t = VertexElementType_get_glinfo(type[i]);
+        SLX_FAIL_COND_NULL(t.type == 0, error_code::enum_mapping_failed);
+        if (i < len - instance_len)
+            stride += t.componentSize * t.count;
+        else
+            instance_stride += t.componentSize * t.count;
+    }
+
+    VertexElementType* tptr = new VertexElementType[len];
+    memcpy(tptr, type, len * sizeof(VertexElementType));
+    vertex_type_handle* h = new vertex_type_handle();
+    h->type_ptr = tptr;
+    h->length = len;
+    h->stride = stride;
+    h->instance_length = instance_len;
+    h->instance_stride = instance_stride;
+    h->stream_vao = 0;
+    h->stream_generation = 0;
+    return h;
+}
+
+#pragma region uniform cache
+
+// larger locations are legal but unusual, they are just never cached
+constexpr GLint max_cached_uniform_location = 1024;
+
+static int32_t uniform_type_components(uniform_type type)
+{
+    switch (type)
+    {
+    case uniform_type::int1: return 1;
+    case uniform_type::float1: return 1;
+    case uniform_type::vec4: return 4;
+    case uniform_type::mat4: return 16;
+    case uniform_type::mat3x2: return 6;
+    }
+    return 0;
+}
+
+// every sampler type of gl 3.3, they are set as ints
+static bool is_sampler_type(GLenum type)
+{
+    return (type >= GL_SAMPLER_1D && type <= GL_SAMPLER_2D_RECT_SHADOW)
+        || (type >= GL_SAMPLER_1D_ARRAY && type <= GL_SAMPLER_CUBE_SHADOW)
+        || (type >= GL_INT_SAMPLER_1D && type <= GL_UNSIGNED_INT_SAMPLER_BUFFER)
+        || (type >= GL_SAMPLER_2D_MULTISAMPLE && type <= GL_UNSIGNED_INT_SAMPLER_2D_MULTISAMPLE_ARRAY);
+}
+
+static bool uniform_type_matches(uniform_type type, GLenum declared)
+{
+    switch (type)
+    {
+    case uniform_type::int1: return declared == GL_INT || declared == GL_BOOL || is_sampler_type(declared);
+    case uniform_type::float1: return declared == GL_FLOAT;
+    case uniform_type::vec4: return declared == GL_FLOAT_VEC4;
+    case uniform_type::mat4: return declared == GL_FLOAT_MAT4;
+    case uniform_type::mat3x2: return declared == GL_FLOAT_MAT3x2;
+    }
+    return false;
+}
+
+// uniform values live in the program, so an upload equal to the last one can always be skipped
+static s_bool set_uniform(shader_handle* shader, GLint loc, uniform_type type, const void* values)
+{
+    int32_t size = uniform_type_components(type) * (int32_t)sizeof(float);
+    SLX_FAIL_COND(size == 0, error_code::invalid_parameter);
+
+    uniform_slot* slot = nullptr;
+    if (loc >= 0 && loc < max_cached_uniform_location)
+    {
+        if ((size_t)loc >= shader->uniforms.size())
+            shader->uniforms.resize((size_t)loc + 1);
+        slot = &shader->uniforms[loc];
+        SLX_FAIL_COND(slot->declared_type != 0 && !uniform_type_matches(type, slot->declared_type), error_code::shader_param_type_mismatch);
+        if (slot->known && slot->type == type && memcmp(slot->values, values, size) == 0)
+        {
+            current_context->uniform_uploads.skipped++;
+            current_context->frame.uniforms.skipped++;
+            return false;
+        }
+    }
+
+    if (ensure_shader(shader->program))
+        return true;
+    switch (type)
+    {
+    case uniform_type::int1: glUniform1i(loc, *(const int32_t*)values); break;
+    case uniform_type::float1: glUniform1f(loc, *(const float*)values); break;
+    case uniform_type::vec4: glUniform4fv(loc, 1, (const float*)values); break;
+    case uniform_type::mat4: glUniformMatrix4fv(loc, 1, true, (const float*)values); break;
+    case uniform_type::mat3x2: glUniformMatrix3x2fv(loc, 1, false, (const float*)values); break;
+    }
+    SLX_FAIL_ON_GL_ERROR();
+
+    if (slot)
+    {
+        slot->known = true;
+        slot->type = type;
+        memcpy(slot->values, values, size);
+    }
+    current_context->uniform_uploads.uploaded++;
+    current_context->frame.uniforms.uploaded++;
+    return false;
+}
+
+#pragma endregion
+
+#pragma region bundle
+
+// state and draw calls made between SLX_BeginBundle and SLX_EndBundle are validated and resolved
+// once, then stored instead of being executed. the handles and buffers they refer to must stay
+// alive as long as the bundle is executed.
+
+enum class bundle_op : s_byte
+{
+    set_shader,
+    set_texture,
+    set_sampler,
+    set_uniform,
+    draw_arrays,
+    draw_elements,
+    draw_data,
+    set_texture_array
+};
+
+struct bundle_bind { GLuint unit; GLuint id; };
+// followed by the values, count decided by the type
+struct bundle_uniform { shader_handle* shader; GLint loc; uniform_type type; };
+// instances is 0 for the non instanced draws
+// 'first' is the first vertex or index, 'index_type' and 'base_vertex' are only used by draw_elements
+struct bundle_draw { GLuint vao; GLenum mode; GLint first; GLsizei count; GLsizei instances; GLenum index_type; GLint base_vertex; };
+// followed by 'size' bytes of vertices
+struct bundle_draw_data { vertex_type_handle* type; PrimitiveType pt; int32_t size; int32_t vertices; };
+
+static void bundle_write(bundle_op op, const void* payload, size_t size, const void* extra = nullptr, size_t extra_size = 0)
+{
+    std::vector<s_byte>& commands = current_context->recording_bundle->commands;
+    size_t at = commands.size();
+    commands.resize(at + 1 + size + extra_size);
+    commands[at] = (s_byte)op;
+    memcpy(&commands[at + 1], payload, size);
+    if (extra_size)
+        memcpy(&commands[at + 1 + size], extra, extra_size);
+}
+
+static s_bool bundle_record_bind(bundle_op op, GLuint unit, GLuint id)
+{
+    bundle_bind cmd{ unit, id };
+    bundle_write(op, &cmd, sizeof(cmd));
+    return false;
+}
+
+static s_bool bundle_record_uniform(shader_handle* shader, GLint loc, uniform_type type, const void* values)
+{
+    int32_t count = uniform_type_components(type);
+    SLX_FAIL_COND(count == 0, error_code::invalid_parameter);
+    bundle_uniform cmd{ shader, loc, type };
+    bundle_write(bundle_op::set_uniform, &cmd, sizeof(cmd), values, count * sizeof(float));
+    return false;
+}
+
+static s_bool bundle_record_draw(bundle_op op, GLuint vao, GLenum mode, GLint first, GLsizei count, GLsizei instances, GLenum index_type, GLint base_vertex)
+{
+    bundle_draw cmd{ vao, mode, first, count, instances, index_type, base_vertex };
+    bundle_write(op, &cmd, sizeof(cmd));
+    return false;
+}
+
+static s_bool bundle_record_draw_data(vertex_type_handle* type, PrimitiveType pt, const void* data, int32_t size, int32_t vertices)
+{
+    bundle_draw_data cmd{ type, pt, size, vertices };
+    bundle_write(bundle_op::draw_data, &cmd, sizeof(cmd), data, size);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_BeginBundle()
+{
+    SLX_TIMED_CALL();
+
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    current_context->recording_bundle = new bundle_handle();
+    return false;
+}
+
+SLX_API bundle_handle* SLX_CALLCONV SLX_EndBundle()
+{
+    SLX_TIMED_CALL();
+
+    SLX_FAIL_COND_NULL(current_context->recording_bundle == nullptr, error_code::bundle_not_recording);
+
+    bundle_handle* bundle = current_context->recording_bundle;
+    bundle->commands.shrink_to_fit();
+    current_context->recording_bundle = nullptr;
+    return bundle;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_ExecuteBundle(P_IN bundle_handle* bundle)
+{
+    SLX_TIMED_CALL();
+
+    assert(bundle != nullptr);
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    const s_byte* p = bundle->commands.data();
+    const s_byte* end = p + bundle->commands.size();
+    while (p < end)
+    {
+        bundle_op op = (bundle_op)*p++;
+        switch (op)
+        {
+        case bundle_op::set_shader:
+        {
+            bundle_bind cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            if (ensure_shader(cmd.id)) return true;
+            current_context->expected_shader = cmd.id;
+            break;
+        }
+        case bundle_op::set_texture:
+        {
+            bundle_bind cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            set_expected_texture(cmd.unit, cmd.id);
+            break;
+        }
+        case bundle_op::set_texture_array:
+        {
+            bundle_bind cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            set_expected_texture_array(cmd.unit, cmd.id);
+            break;
+        }
+        case bundle_op::set_sampler:
+        {
+            bundle_bind cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            if (ensure_sampler(cmd.unit, cmd.id)) return true;
+            break;
+        }
+        case bundle_op::set_uniform:
+        {
+            bundle_uniform cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            // copied out as the stream has no alignment
+            float values[16];
+            size_t size = uniform_type_components(cmd.type) * sizeof(float);
+            memcpy(values, p, size);
+            p += size;
+            if (set_uniform(cmd.shader, cmd.loc, cmd.type, values)) return true;
+            break;
+        }
+        case bundle_op::draw_arrays:
+        case bundle_op::draw_elements:
+        {
+            bundle_draw cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            if (apply_expected_state()) return true;
+            if (ensure_vao(cmd.vao)) return true;
+            if (op == bundle_op::draw_arrays)
+            {
+                count_draw(cmd.count, 0, cmd.instances ? cmd.instances : 1);
+                if (cmd.instances)
+                    glDrawArraysInstanced(cmd.mode, cmd.first, cmd.count, cmd.instances);
+                else
+                    glDrawArrays(cmd.mode, cmd.first, cmd.count);
+            }
+            else
+            {
+                count_draw(0, cmd.count, cmd.instances ? cmd.instances : 1);
+                const void* offset = index_offset(cmd.index_type, cmd.first);
+                if (cmd.instances)
+                    glDrawElementsInstancedBaseVertex(cmd.mode, cmd.count, cmd.index_type, offset, cmd.instances, cmd.base_vertex);
+                else
+                    glDrawElementsBaseVertex(cmd.mode, cmd.count, cmd.index_type, offset, cmd.base_vertex);
+            }
+            break;
+        }
+        case bundle_op::draw_data:
+        {
+            bundle_draw_data cmd;
+            memcpy(&cmd, p, sizeof(cmd));
+            p += sizeof(cmd);
+            if (SLX_DrawPrimitives(cmd.type, cmd.pt, (void*)p, cmd.size, cmd.vertices)) return true;
+            p += cmd.size;
+            break;
+        }
+        default:
+            assert(false);
+            SLX_FAIL(error_code::invalid_parameter);
+        }
+    }
+    // everything was validated when recording, so errors are only checked once here
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteBundle(P_IN bundle_handle* bundle)
+{
+    SLX_TIMED_CALL();
+
+    assert(bundle != nullptr);
+    assert(bundle != current_context->recording_bundle);
+
+    delete bundle;
+    return false;
+}
+
+#pragma endregion
+
+#pragma region gpu profiler
+
+// scopes are bracketed by GL_TIMESTAMP queries rather than GL_TIME_ELAPSED ones, as those can't nest.
+// each frame owns a slot of queries that is only read back 'gpu_profiler_latency' frames later
+
+static GLuint profiler_query(gpu_profiler_frame& frame, int32_t index)
+{
+    while ((int32_t)frame.queries.size() <= index)
+    {
+        GLuint query;
+        glGenQueries(1, &query);
+        frame.queries.push_back(query);
+    }
+    return frame.queries[index];
+}
+
+static void profiler_begin_frame()
+{
+    gpu_profiler& prof = current_context->profiler;
+    gpu_profiler_frame& frame = prof.frames[prof.current];
+    frame.scopes.clear();
+    frame.frame = prof.frame;
+    frame.pending = false;
+    prof.open_scopes.clear();
+    glQueryCounter(profiler_query(frame, 0), GL_TIMESTAMP);
+}
+
+// copies the results of a finished slot, or drops them if the gpu is that far behind
+static void profiler_collect(gpu_profiler_frame& frame)
+{
+    gpu_profiler& prof = current_context->profiler;
+    frame.pending = false;
+    GLint available = 0;
+    // queries complete in order, the frame end being done means all of them are
+    glGetQueryObjectiv(frame.queries[1], GL_QUERY_RESULT_AVAILABLE, &available);
+    if (!available)
+    {
+        prof.result_info.dropped_frames++;
+        return;
+    }
+
+    GLuint64 start, end;
+    glGetQueryObjectui64v(frame.queries[0], GL_QUERY_RESULT, &start);
+    glGetQueryObjectui64v(frame.queries[1], GL_QUERY_RESULT, &end);
+    prof.results.resize(frame.scopes.size());
+    for (size_t i = 0; i < frame.scopes.size(); i++)
+    {
+        GLuint64 begin, finish;
+        glGetQueryObjectui64v(frame.queries[2 + i * 2], GL_QUERY_RESULT, &begin);
+        glGetQueryObjectui64v(frame.queries[3 + i * 2], GL_QUERY_RESULT, &finish);
+        gpu_scope_result& r = prof.results[i];
+        r = frame.scopes[i];
+        r.begin = (int64_t)(begin - start);
+        r.duration = (int64_t)(finish - begin);
+    }
+    prof.result_info.frame = frame.frame;
+    prof.result_info.duration = (int64_t)(end - start);
+    prof.result_info.scope_count = (int32_t)frame.scopes.size();
+}
+
+static void profiler_end_frame()
+{
+    gpu_profiler& prof = current_context->profiler;
+    gpu_profiler_frame& frame = prof.frames[prof.current];
+
+    // scopes left open are closed at the frame end
+    for (int32_t index : prof.open_scopes)
+        glQueryCounter(profiler_query(frame, 3 + index * 2), GL_TIMESTAMP);
+    glQueryCounter(profiler_query(frame, 1), GL_TIMESTAMP);
+    frame.pending = true;
+
+    prof.frame++;
+    prof.current = (prof.current + 1) % gpu_profiler_latency;
+    gpu_profiler_frame& oldest = prof.frames[prof.current];
+    if (oldest.pending)
+        profiler_collect(oldest);
+    profiler_begin_frame();
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetGpuProfiling(s_bool enabled)
+{
+    SLX_TIMED_CALL();
+
+    gpu_profiler& prof = current_context->profiler;
+    if (!enabled == !prof.enabled)
+        return false;
+
+    prof.enabled = enabled;
+    for (gpu_profiler_frame& frame : prof.frames)
+        frame.pending = false;
+    if (enabled)
+    {
+        prof.result_info.frame = -1;
+        profiler_begin_frame();
+    }
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GpuScopeBegin(int32_t name)
+{
+    SLX_TIMED_CALL();
+
+    gpu_profiler& prof = current_context->profiler;
+    if (!prof.enabled)
+        return false;
+
+    gpu_profiler_frame& frame = prof.frames[prof.current];
+    int32_t index = (int32_t)frame.scopes.size();
+    if (index >= max_gpu_scopes)
+    {
+        // still tracked so its end matches, but not timed
+        prof.open_scopes.push_back(-1);
+        return false;
+    }
+    frame.scopes.push_back({ name, (int32_t)prof.open_scopes.size(), 0, 0 });
+    prof.open_scopes.push_back(index);
+    glQueryCounter(profiler_query(frame, 2 + index * 2), GL_TIMESTAMP);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GpuScopeEnd()
+{
+    SLX_TIMED_CALL();
+
+    gpu_profiler& prof = current_context->profiler;
+    if (!prof.enabled)
+        return false;
+    SLX_FAIL_COND(prof.open_scopes.empty(), error_code::invalid_parameter);
+
+    int32_t index = prof.open_scopes.back();
+    prof.open_scopes.pop_back();
+    if (index < 0)
+        return false;
+    glQueryCounter(profiler_query(prof.frames[prof.current], 3 + index * 2), GL_TIMESTAMP);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GetGpuFrameResults(P_OUT gpu_frame_info* out_info, P_OUT gpu_scope_result* out_scopes, int32_t capacity)
+{
+    assert(out_info != nullptr);
+    assert(capacity == 0 || out_scopes != nullptr);
+
+    gpu_profiler& prof = current_context->profiler;
+    *out_info = prof.result_info;
+    int32_t count = out_info->scope_count < capacity ? out_info->scope_count : capacity;
+    if (count > 0)
+        memcpy(out_scopes, prof.results.data(), count * sizeof(gpu_scope_result));
+    return false;
+}
+
+#pragma endregion
+
+#pragma region stream
+
+constexpr int32_t stream_initial_region_size = 1 << 20;
+
+static s_bool stream_wait_region(int32_t region)
+{
+    GLsync& fence = current_context->stream.fences[region];
+    if (!fence)
+        return false;
+
+    GLenum result;
+    do result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    while (result == GL_TIMEOUT_EXPIRED);
+    glDeleteSync(fence);
+    fence = nullptr;
+    SLX_FAIL_COND(result == GL_WAIT_FAILED, error_code::graphics_api_error);
+    return false;
+}
+
+static s_bool stream_unmap()
+{
+    stream_buffer& st = current_context->stream;
+    if (!st.mapped)
+        return false;
+
+    if (ensure_vbo(st.vbo)) return true;
+    st.mapped = false;
+    glUnmapBuffer(GL_ARRAY_BUFFER);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+static s_bool stream_allocate(int32_t region_size)
+{
+    stream_buffer& st = current_context->stream;
+    SLX_FAIL_COND(region_size > INT32_MAX / stream_regions, error_code::invalid_parameter);
+
+    // the old storage is kept alive by the driver until the draws using it are done,
+    // so there's no need to wait for the fences here
+    if (st.vbo)
+    {
+        glDeleteBuffers(1, &st.vbo);
+        clear_if_equal(current_context->current_vbo, st.vbo);
+        st.vbo = 0;
+        st.mapped = false;
+    }
+    for (GLsync& fence : st.fences)
+    {
+        if (fence) glDeleteSync(fence);
+        fence = nullptr;
+    }
+
+    GLsizeiptr size = (GLsizeiptr)region_size * stream_regions;
+    glGenBuffers(1, &st.vbo);
+    if (ensure_vbo(st.vbo)) return true;
+    if (GLAD_GL_ARB_buffer_storage)
+    {
+        GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+        glBufferStorage(GL_ARRAY_BUFFER, size, nullptr, flags);
+        SLX_FAIL_ON_GL_ERROR();
+        st.persistent = (s_byte*)glMapBufferRange(GL_ARRAY_BUFFER, 0, size, flags);
+        SLX_FAIL_ON_GL_ERROR();
+        SLX_FAIL_COND(st.persistent == nullptr, error_code::graphics_api_error);
+    }
+    else
+    {
+        st.persistent = nullptr;
+        glBufferData(GL_ARRAY_BUFFER, size, nullptr, GL_STREAM_DRAW);
+        SLX_FAIL_ON_GL_ERROR();
+    }
+
+    st.region_size = region_size;
+    st.head = st.region * region_size;
+    st.generation++;
+    return false;
+}
+
+static void* stream_map(int32_t size, int32_t stride, P_OUT int32_t* out_offset)
+{
+    assert(size >= 1);
+    assert(stride >= 1);
+
+    stream_buffer& st = current_context->stream;
+    if (stream_unmap()) return nullptr;
+    if (st.vbo == 0 && stream_allocate(stream_initial_region_size)) return nullptr;
+
+    // offsets are kept as a multiple of the stride so draws can address them by vertex index
+    int32_t offset = (st.head + stride - 1) / stride * stride;
+    if ((int64_t)offset + size > (int64_t)(st.region + 1) * st.region_size)
+    {
+        // this frame needs more than one region, grow and start over from the region beginning
+        int64_t region_size = (int64_t)st.region_size * 2;
+        while (region_size < (int64_t)size + stride)
+            region_size *= 2;
+        SLX_FAIL_COND_NULL(region_size > INT32_MAX, error_code::invalid_parameter);
+        if (stream_allocate((int32_t)region_size)) return nullptr;
+        offset = (st.head + stride - 1) / stride * stride;
+    }
+    st.head = offset + size;
+    *out_offset = offset;
+    current_context->frame.buffer_bytes += size;
+
+    if (st.persistent)
+        return st.persistent + offset;
+
+    if (ensure_vbo(st.vbo)) return nullptr;
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+    void* ptr = glMapBufferRange(GL_ARRAY_BUFFER, offset, size, access);
+    SLX_FAIL_ON_GL_ERROR_NULL();
+    SLX_FAIL_COND_NULL(ptr == nullptr, error_code::graphics_api_error);
+    st.mapped = true;
+    return ptr;
+}
+
+// (re)creates the vao of a vertex layout reading from the streaming buffer
+static s_bool ensure_stream_vao(VertexElementType* type, int32_t len, GLuint ibo, P_INOUT GLuint* vao, P_INOUT uint32_t* generation)
+{
+    stream_buffer& st = current_context->stream;
+    if (*vao != 0 && *generation == st.generation)
+        return ensure_vao(*vao);
+
+    if (*vao != 0)
+    {
+        glDeleteVertexArrays(1, vao);
+        clear_if_equal(current_context->current_vao, *vao);
+        *vao = 0;
+    }
+    if (ensure_vbo(st.vbo)) return true;
+    if (make_vao(type, len, 0, 0, vao)) return true;
+    if (ibo && ensure_ibo(ibo)) return true;
+    *generation = st.generation;
+    return false;
+}
+
+void graphics_end_frame()
+{
+    if (current_context->error_policy == gl_error_policy::per_frame)
+        check_frame_gl_errors();
+    if (current_context->profiler.enabled)
+        profiler_end_frame();
+
+    stream_buffer& st = current_context->stream;
+    if (st.vbo == 0)
+        return;
+
+    // fence the region written this frame and move on to the oldest one
+    if (stream_unmap()) return;
+    st.fences[st.region] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    st.region = (st.region + 1) % stream_regions;
+    st.head = st.region * st.region_size;
+    stream_wait_region(st.region);
+}
+
+SLX_API void* SLX_CALLCONV SLX_MapStreamBuffer(int32_t size, int32_t stride, P_OUT int32_t* out_offset)
+{
+    SLX_TIMED_CALL();
+
+    assert(size >= 1);
+    assert(stride >= 1);
+    assert(out_offset != nullptr);
+    SLX_FAIL_COND_NULL(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    return stream_map(size, stride, out_offset);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DrawStreamPrimitives(P_IN vertex_type_handle* vertex_type, PrimitiveType pt, int32_t offset, int32_t vertices_to_draw)
+{
+    SLX_TIMED_CALL();
+
+    assert(vertex_type != nullptr);
+    assert(vertex_type->instance_length == 0);
+    assert(offset >= 0 && offset % vertex_type->stride == 0);
+    assert(vertices_to_draw >= 1);
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    GLenum type = PrimitiveType_get_glinfo(pt);
+    SLX_FAIL_MAPENUM_COND(type);
+    if (apply_expected_state()) return true;
+    if (stream_unmap()) return true;
+    // the ring is also the element buffer of the stream vaos, see SLX_DrawIndexedPrimitives
+    if (ensure_stream_vao(vertex_type->type_ptr, vertex_type->length, current_context->stream.vbo, &vertex_type->stream_vao, &vertex_type->stream_generation))
+        return true;
+
+    glDrawArrays(type, offset / vertex_type->stride, vertices_to_draw);
+    SLX_FAIL_ON_GL_ERROR();
+    count_draw(vertices_to_draw, 0, 1);
+    return false;
+}
+
+#pragma endregion
+
+SLX_API s_bool SLX_CALLCONV SLX_DrawPrimitives(
+    P_IN vertex_type_handle* vertex_type,
+    PrimitiveType pt,
+    void* data, int32_t data_size,
+    int32_t vertices_to_draw
+)
+{
+    SLX_TIMED_CALL();
+
+    assert(vertex_type != nullptr);
+    assert(data != 0);
+    assert(data_size >= 1);
+    assert(vertices_to_draw >= 1);
+
+    if (current_context->recording_bundle)
+    {
+        SLX_FAIL_MAPENUM_COND(PrimitiveType_get_glinfo(pt));
+        return bundle_record_draw_data(vertex_type, pt, data, data_size, vertices_to_draw);
+    }
+
+    int32_t offset;
+    void* ptr = stream_map(data_size, vertex_type->stride, &offset);
+    if (ptr == nullptr) return true;
+    memcpy(ptr, data, data_size);
+
+    return SLX_DrawStreamPrimitives(vertex_type, pt, offset, vertices_to_draw);
+}
+
+// vertices and indices are copied into one range of the streaming buffer, so neither can be moved by the other's map
+SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedPrimitives(
+    P_IN vertex_type_handle* vertex_type,
+    PrimitiveType pt,
+    P_IN void* vertices, int32_t vertices_size,
+    P_IN void* indices, int32_t indices_size, IndexType index_type
+)
+{
+    SLX_TIMED_CALL();
+
+    assert(vertex_type != nullptr);
+    assert(vertex_type->instance_length == 0);
+    assert(vertices != nullptr);
+    assert(indices != nullptr);
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    GLenum type = PrimitiveType_get_glinfo(pt);
+    SLX_FAIL_MAPENUM_COND(type);
+    index_type_glinfo index_info = IndexType_get_glinfo(index_type);
+    SLX_FAIL_MAPENUM_COND(index_info.type);
+    int32_t stride = vertex_type->stride;
+    SLX_FAIL_COND(vertices_size < stride || vertices_size % stride != 0, error_code::invalid_parameter);
+    SLX_FAIL_COND(indices_size < index_info.size || indices_size % index_info.size != 0, error_code::invalid_parameter);
+    SLX_FAIL_COND(indices_size > INT32_MAX - vertices_size - index_info.size, error_code::invalid_parameter);
+
+    // the indices follow the vertices, the range has room to align them to their own size
+    int32_t offset;
+    s_byte* ptr = (s_byte*)stream_map(vertices_size + index_info.size - 1 + indices_size, stride, &offset);
+    if (ptr == nullptr) return true;
+    int32_t indices_at = (offset + vertices_size + index_info.size - 1) / index_info.size * index_info.size - offset;
+    memcpy(ptr, vertices, vertices_size);
+    memcpy(ptr + indices_at, indices, indices_size);
+
+    if (apply_expected_state()) return true;
+    if (stream_unmap()) return true;
+    if (ensure_stream_vao(vertex_type->type_ptr, vertex_type->length, current_context->stream.vbo, &vertex_type->stream_vao, &vertex_type->stream_generation))
+        return true;
+
+    int32_t indices_count = indices_size / index_info.size;
+    glDrawElementsBaseVertex(type, indices_count, index_info.type, (const void*)(intptr_t)(offset + indices_at), offset / stride);
+    SLX_FAIL_ON_GL_ERROR();
+    count_draw(0, indices_count, 1);
+    return false;
+}
+
+SLX_API buffer_handle* SLX_CALLCONV SLX_CreateVertexBuffer(P_IN vertex_type_handle* vertex_type, s_bool use_ibo)
+{
+    SLX_TIMED_CALL();
+
+    assert(vertex_type != nullptr);
+    assert(use_ibo == 0 || use_ibo == 1);
+
+    GLuint id;
+    glGenBuffers(1, &id);
+    ensure_vbo(id);
+    buffer_handle* h = new buffer_handle();
+    h->vbo = id;
+
+    h->instance_vbo = 0;
+    if (vertex_type->instance_length)
+        glGenBuffers(1, &h->instance_vbo);
+
+    if (make_vao(vertex_type->type_ptr, vertex_type->length, vertex_type->instance_length, h->instance_vbo, &h->vao))
+    {
+        glDeleteBuffers(1, &id);
+        if (h->instance_vbo)
+            glDeleteBuffers(1, &h->instance_vbo);
+        delete h;
+        return nullptr;
+    }
+
+    h->ibo = 0;
+    h->index_type = GL_UNSIGNED_SHORT;
+    h->vertex_bytes = 0;
+    h->index_bytes = 0;
+    if (use_ibo)
+    {
+        glGenBuffers(1, &h->ibo);
+        if (ensure_ibo(h->ibo)) return nullptr;
+    }
+    return h;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteVertexBuffer(P_IN buffer_handle* buffer)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+
+    glDeleteVertexArrays(1, &buffer->vao);
+    SLX_FAIL_ON_GL_ERROR();
+    glDeleteBuffers(1, &buffer->vbo);
+    SLX_FAIL_ON_GL_ERROR();
+    if (buffer->ibo)
+    {
+        glDeleteBuffers(1, &buffer->ibo);
+        SLX_FAIL_ON_GL_ERROR();
+    }
+    if (buffer->instance_vbo)
+    {
+        glDeleteBuffers(1, &buffer->instance_vbo);
+        SLX_FAIL_ON_GL_ERROR();
+    }
+    if (current_context->current_vao == buffer->vao)
+    {
+        current_context->current_vao = 0;
+        current_context->current_ibo = unknown_binding;
+    }
+    clear_if_equal(current_context->current_vbo, buffer->vbo);
+    clear_if_equal(current_context->current_vbo, buffer->instance_vbo);
+    clear_if_equal(current_context->current_ibo, buffer->ibo);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetVertexBufferData(buffer_handle* buffer, void* data, int32_t dataSize, VertexBufferDataUsage data_usage)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(data != nullptr);
+    assert(dataSize >= 1);
+
+    if (ensure_vbo(buffer->vbo)) return true;
+    if (ensure_vao(buffer->vao)) return true;
+    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
+    SLX_FAIL_MAPENUM_COND(usage);
+    glBufferData(GL_ARRAY_BUFFER, dataSize, data, usage);
+    SLX_FAIL_ON_GL_ERROR();
+    buffer->vertex_bytes = dataSize;
+    current_context->frame.buffer_bytes += dataSize;
+    return false;
+}
+
+// respecifies the store without data, to be filled by SLX_SetVertexBufferSubData
+SLX_API s_bool SLX_CALLCONV SLX_AllocateVertexBuffer(buffer_handle* buffer, int32_t dataSize, VertexBufferDataUsage data_usage)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    SLX_FAIL_COND(dataSize < 1, error_code::invalid_parameter);
+
+    if (ensure_vbo(buffer->vbo)) return true;
+    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
+    SLX_FAIL_MAPENUM_COND(usage);
+    glBufferData(GL_ARRAY_BUFFER, dataSize, nullptr, usage);
+    SLX_FAIL_ON_GL_ERROR();
+    buffer->vertex_bytes = dataSize;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetVertexBufferSubData(buffer_handle* buffer, int32_t offset, P_IN void* data, int32_t dataSize)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(data != nullptr);
+    SLX_FAIL_COND(offset < 0 || dataSize < 1 || dataSize > buffer->vertex_bytes - offset, error_code::invalid_parameter);
+
+    if (ensure_vbo(buffer->vbo)) return true;
+    glBufferSubData(GL_ARRAY_BUFFER, offset, dataSize, data);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.buffer_bytes += dataSize;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DrawBufferPrimitives(buffer_handle* buffer, PrimitiveType primitiveType, int32_t first, int32_t verticesCount)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(first >= 0);
+    assert(verticesCount >= 1);
+
+    GLenum type = PrimitiveType_get_glinfo(primitiveType);
+    SLX_FAIL_MAPENUM_COND(type);
+    if (current_context->recording_bundle)
+        return bundle_record_draw(bundle_op::draw_arrays, buffer->vao, type, first, verticesCount, 0, 0, 0);
+
+    if (apply_expected_state()) return true;
+
+    if (ensure_vbo(buffer->vbo)) return true;
+    if (ensure_vao(buffer->vao)) return true;
+    glDrawArrays(type, first, verticesCount);
+    SLX_FAIL_ON_GL_ERROR();
+    count_draw(verticesCount, 0, 1);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetIndexBufferData(buffer_handle* buffer, void* data, int32_t dataSize, VertexBufferDataUsage data_usage, IndexType index_type)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(buffer->ibo != 0);
+
+    index_type_glinfo index_info = IndexType_get_glinfo(index_type);
+    SLX_FAIL_MAPENUM_COND(index_info.type);
+    SLX_FAIL_COND(dataSize % index_info.size != 0, error_code::invalid_parameter);
+    if (ensure_vao(buffer->vao)) return true;
+    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
+    SLX_FAIL_MAPENUM_COND(usage);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, data, usage);
+    SLX_FAIL_ON_GL_ERROR();
+    buffer->index_type = index_info.type;
+    buffer->index_bytes = dataSize;
+    current_context->frame.buffer_bytes += dataSize;
+    return false;
+}
+
+// respecifies the store without data, to be filled by SLX_SetIndexBufferSubData
+SLX_API s_bool SLX_CALLCONV SLX_AllocateIndexBuffer(buffer_handle* buffer, int32_t dataSize, VertexBufferDataUsage data_usage, IndexType index_type)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(buffer->ibo != 0);
+
+    index_type_glinfo index_info = IndexType_get_glinfo(index_type);
+    SLX_FAIL_MAPENUM_COND(index_info.type);
+    SLX_FAIL_COND(dataSize < 1 || dataSize % index_info.size != 0, error_code::invalid_parameter);
+    // the element binding lives in the vao
+    if (ensure_vao(buffer->vao)) return true;
+    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
+    SLX_FAIL_MAPENUM_COND(usage);
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, dataSize, nullptr, usage);
+    SLX_FAIL_ON_GL_ERROR();
+    buffer->index_type = index_info.type;
+    buffer->index_bytes = dataSize;
+    return false;
+}
+
+// 'offset' is in bytes and must be aligned to the index type of the buffer
+SLX_API s_bool SLX_CALLCONV SLX_SetIndexBufferSubData(buffer_handle* buffer, int32_t offset, P_IN void* data, int32_t dataSize)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(buffer->ibo != 0);
+    assert(data != nullptr);
+    SLX_FAIL_COND(offset < 0 || dataSize < 1 || dataSize > buffer->index_bytes - offset, error_code::invalid_parameter);
+    int32_t size = index_size(buffer->index_type);
+    SLX_FAIL_COND(offset % size != 0 || dataSize % size != 0, error_code::invalid_parameter);
+
+    if (ensure_vao(buffer->vao)) return true;
+    glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.buffer_bytes += dataSize;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedBufferPrimitives(buffer_handle* buffer, PrimitiveType primitiveType, int32_t first_index, int32_t indicesCount, int32_t base_vertex)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(first_index >= 0);
+    assert(indicesCount >= 1);
+
+    GLenum type = PrimitiveType_get_glinfo(primitiveType);
+    SLX_FAIL_MAPENUM_COND(type);
+    if (current_context->recording_bundle)
+        return bundle_record_draw(bundle_op::draw_elements, buffer->vao, type, first_index, indicesCount, 0, buffer->index_type, base_vertex);
+
+    if (apply_expected_state()) return true;
+
+    if (ensure_vbo(buffer->vbo)) return true;
+    if (ensure_vao(buffer->vao)) return true;
+    glDrawElementsBaseVertex(type, indicesCount, buffer->index_type, index_offset(buffer->index_type, first_index), base_vertex);
+    SLX_FAIL_ON_GL_ERROR();
+    count_draw(0, indicesCount, 1);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetInstanceBufferData(buffer_handle* buffer, void* data, int32_t dataSize, VertexBufferDataUsage data_usage)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(buffer->instance_vbo != 0);
+    assert(data != nullptr);
+    assert(dataSize >= 1);
+
+    if (ensure_vbo(buffer->instance_vbo)) return true;
+    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
+    SLX_FAIL_MAPENUM_COND(usage);
+    glBufferData(GL_ARRAY_BUFFER, dataSize, data, usage);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.buffer_bytes += dataSize;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DrawInstanced(buffer_handle* buffer, PrimitiveType primitiveType, int32_t first, int32_t verticesCount, int32_t instanceCount)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(first >= 0);
+    assert(verticesCount >= 1);
+    assert(instanceCount >= 1);
+
+    GLenum type = PrimitiveType_get_glinfo(primitiveType);
+    SLX_FAIL_MAPENUM_COND(type);
+    if (current_context->recording_bundle)
+        return bundle_record_draw(bundle_op::draw_arrays, buffer->vao, type, first, verticesCount, instanceCount, 0, 0);
+
+    if (apply_expected_state()) return true;
+
+    if (ensure_vao(buffer->vao)) return true;
+    glDrawArraysInstanced(type, first, verticesCount, instanceCount);
+    SLX_FAIL_ON_GL_ERROR();
+    count_draw(verticesCount, 0, instanceCount);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedInstanced(buffer_handle* buffer, PrimitiveType primitiveType, int32_t first_index, int32_t indicesCount, int32_t base_vertex, int32_t instanceCount)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(buffer->ibo != 0);
+    assert(first_index >= 0);
+    assert(indicesCount >= 1);
+    assert(instanceCount >= 1);
+
+    GLenum type = PrimitiveType_get_glinfo(primitiveType);
+    SLX_FAIL_MAPENUM_COND(type);
+    if (current_context->recording_bundle)
+        return bundle_record_draw(bundle_op::draw_elements, buffer->vao, type, first_index, indicesCount, instanceCount, buffer->index_type, base_vertex);
+
+    if (apply_expected_state()) return true;
+
+    if (ensure_vao(buffer->vao)) return true;
+    glDrawElementsInstancedBaseVertex(type, indicesCount, buffer->index_type, index_offset(buffer->index_type, first_index), instanceCount, base_vertex);
+    SLX_FAIL_ON_GL_ERROR();
+    count_draw(0, indicesCount, instanceCount);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_MultiDrawIndexed(buffer_handle* buffer, PrimitiveType primitiveType, P_IN indexed_draw_range* ranges, int32_t count)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(buffer->ibo != 0);
+    assert(ranges != nullptr);
+    assert(count >= 1);
+
+    GLenum type = PrimitiveType_get_glinfo(primitiveType);
+    SLX_FAIL_MAPENUM_COND(type);
+    // bundles replay draw by draw, so the ranges are recorded as separate draws
+    if (current_context->recording_bundle)
+    {
+        for (int32_t i = 0; i < count; i++)
+            bundle_record_draw(bundle_op::draw_elements, buffer->vao, type, ranges[i].first_index, ranges[i].count, 0, buffer->index_type, ranges[i].base_vertex);
+        return false;
+    }
+
+    std::vector<GLsizei>& counts = current_context->multi_draw_counts;
+    std::vector<const void*>& offsets = current_context->multi_draw_offsets;
+    std::vector<GLint>& base_vertices = current_context->multi_draw_base_vertices;
+    counts.resize(count);
+    offsets.resize(count);
+    base_vertices.resize(count);
+    int64_t indices = 0;
+    for (int32_t i = 0; i < count; i++)
+    {
+        SLX_FAIL_COND(ranges[i].first_index < 0 || ranges[i].count < 1, error_code::invalid_parameter);
+        counts[i] = ranges[i].count;
+        offsets[i] = index_offset(buffer->index_type, ranges[i].first_index);
+        base_vertices[i] = ranges[i].base_vertex;
+        indices += ranges[i].count;
+    }
+
+    if (apply_expected_state()) return true;
+
+    if (ensure_vao(buffer->vao)) return true;
+    glMultiDrawElementsBaseVertex(type, counts.data(), buffer->index_type, offsets.data(), count, base_vertices.data());
+    SLX_FAIL_ON_GL_ERROR();
+    // a single call, however many ranges it draws
+    count_draw(0, indices, 1);
+    return false;
+}
+
+#pragma region sprite
+
+// 16-bit indices can address 65536 vertices, which is exactly 16384 quads
+constexpr int32_t max_sprites_per_draw = 65536 / 4;
+
+static s_bool ensure_sprite_batcher()
+{
+    if (current_context->sprite_ibo != 0)
+        return false;
+
+    // the quad index pattern never changes, so fill it only once
+    std::vector<uint16_t> indices(max_sprites_per_draw * 6);
+    for (int32_t i = 0; i < max_sprites_per_draw; i++)
+    {
+        uint16_t v = (uint16_t)(i * 4);
+        uint16_t* p = &indices[i * 6];
+        p[0] = v + 0; p[1] = v + 1; p[2] = v + 2;
+        p[3] = v + 1; p[4] = v + 2; p[5] = v + 3;
+    }
+    // use the copy target so the element binding of the current vao is left untouched
+    glGenBuffers(1, &current_context->sprite_ibo);
+    glBindBuffer(GL_COPY_WRITE_BUFFER, current_context->sprite_ibo);
+    glBufferData(GL_COPY_WRITE_BUFFER, indices.size() * sizeof(uint16_t), indices.data(), GL_STATIC_DRAW);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+// vertex order: top-left, top-right, bottom-left, bottom-right
+static void emit_sprite_vertices(P_IN const sprite_desc* sprites, int32_t count, P_OUT sprite_vertex* out)
+{
+    for (int32_t i = 0; i < count; i++, out += 4)
+    {
+        const sprite_desc& s = sprites[i];
+        float sin = 0.0f, cos = 1.0f;
+        if (s.radians != 0.0f)
+        {
+            sin = std::sin(s.radians);
+            cos = std::cos(s.radians);
+        }
+
+#ifdef SLX_SPRITE_SSE
+        // all four corners are transformed at once, one lane per corner
+        __m128 ox = _mm_set1_ps(s.origin_x * s.width);
+        __m128 oy = _mm_set1_ps(s.origin_y * s.height);
+        __m128 lx = _mm_mul_ps(_mm_sub_ps(_mm_setr_ps(0.0f, s.width, 0.0f, s.width), ox), _mm_set1_ps(s.scale_x));
+        __m128 ly = _mm_mul_ps(_mm_sub_ps(_mm_setr_ps(0.0f, 0.0f, s.height, s.height), oy), _mm_set1_ps(s.scale_y));
+        __m128 vsin = _mm_set1_ps(sin);
+        __m128 vcos = _mm_set1_ps(cos);
+        __m128 vx = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(lx, vcos), _mm_mul_ps(ly, vsin)), _mm_set1_ps(s.x));
+        __m128 vy = _mm_add_ps(_mm_add_ps(_mm_mul_ps(lx, vsin), _mm_mul_ps(ly, vcos)), _mm_set1_ps(s.y));
+
+        __m128 xy01 = _mm_unpacklo_ps(vx, vy);
+        __m128 xy23 = _mm_unpackhi_ps(vx, vy);
+        __m128 color = _mm_loadu_ps(&s.r);
+        __m128 ba = _mm_movehl_ps(color, color);
+        __m128 uv = _mm_loadu_ps(&s.u0);
+
+        float* o = (float*)out;
+        _mm_storeu_ps(o + 0, _mm_movelh_ps(xy01, color));
+        _mm_storeu_ps(o + 4, _mm_movelh_ps(ba, uv));
+        _mm_storeu_ps(o + 8, _mm_shuffle_ps(xy01, color, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(o + 12, _mm_movelh_ps(ba, _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(0, 0, 1, 2))));
+        _mm_storeu_ps(o + 16, _mm_movelh_ps(xy23, color));
+        _mm_storeu_ps(o + 20, _mm_movelh_ps(ba, _mm_shuffle_ps(uv, uv, _MM_SHUFFLE(0, 0, 3, 0))));
+        _mm_storeu_ps(o + 24, _mm_shuffle_ps(xy23, color, _MM_SHUFFLE(1, 0, 3, 2)));
+        _mm_storeu_ps(o + 28, _mm_shuffle_ps(ba, uv, _MM_SHUFFLE(3, 2, 1, 0)));
+#else
+        float cx[4] = { 0.0f, s.width, 0.0f, s.width };
+        float cy[4] = { 0.0f, 0.0f, s.height, s.height };
+        float cu[4] = { s.u0, s.u1, s.u0, s.u1 };
+        float cv[4] = { s.v0, s.v0, s.v1, s.v1 };
+        for (int c = 0; c < 4; c++)
+        {
+            float lx = (cx[c] - s.origin_x * s.width) * s.scale_x;
+            float ly = (cy[c] - s.origin_y * s.height) * s.scale_y;
+            out[c] = sprite_vertex{
+                lx * cos - ly * sin + s.x, lx * sin + ly * cos + s.y,
+                s.r, s.g, s.b, s.a,
+                cu[c], cv[c]
+            };
+        }
+#endif
+    }
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SubmitSprites(P_IN sprite_desc* sprites, int32_t count, P_OUT int32_t* out_draw_calls)
+{
+    SLX_TIMED_CALL();
+
+    assert(sprites != nullptr);
+    assert(count >= 1);
+    assert(out_draw_calls != nullptr);
+
+    *out_draw_calls = 0;
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+    if (ensure_sprite_batcher()) return true;
+    SLX_FAIL_COND(count > INT32_MAX / 4 / (int32_t)sizeof(sprite_vertex), error_code::invalid_parameter);
+
+    // vertices are written straight into the streaming buffer
+    int32_t offset;
+    sprite_vertex* vertices = (sprite_vertex*)stream_map(count * 4 * sizeof(sprite_vertex), sizeof(sprite_vertex), &offset);
+    if (vertices == nullptr) return true;
+    emit_sprite_vertices(sprites, count, vertices);
+    if (stream_unmap()) return true;
+
+    VertexElementType type[] = { VertexElementType::Vector2, VertexElementType::Color, VertexElementType::Vector2 };
+    GLint base_vertex = offset / (int32_t)sizeof(sprite_vertex);
+
+    // one draw per run of sprites sharing a texture, all from the single write above
+    int32_t begin = 0;
+    while (begin < count)
+    {
+        void* tex_handle = sprites[begin].tex_handle;
+        int32_t end = begin + 1;
+        while (end < count && end - begin < max_sprites_per_draw && sprites[end].tex_handle == tex_handle)
+            end++;
+
+        if (SLX_SetTexture(0, tex_handle)) return true;
+        if (apply_expected_state()) return true;
+        if (ensure_stream_vao(type, 3, current_context->sprite_ibo, &current_context->sprite_vao, &current_context->sprite_vao_generation))
+            return true;
+        glDrawElementsBaseVertex(GL_TRIANGLES, (end - begin) * 6, GL_UNSIGNED_SHORT, 0, base_vertex + begin * 4);
+        SLX_FAIL_ON_GL_ERROR();
+        count_draw(0, (end - begin) * 6, 1);
+        (*out_draw_calls)++;
+        begin = end;
+    }
+    return false;
+}
+
+static s_bool ensure_sprite_instancing()
+{
+    if (current_context->sprite_instance_vao != 0)
+        return false;
+
+    // the shared unit quad, drawn as a triangle strip and scaled per instance in the vertex shader
+    const float corners[] = { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 1.0f, 1.0f, 1.0f };
+    GLuint vbo = 0, vao = 0;
+    glGenBuffers(1, &vbo);
+    if (ensure_vbo(vbo)) goto err;
+    glBufferData(GL_ARRAY_BUFFER, sizeof(corners), corners, GL_STATIC_DRAW);
+    SLX_FAIL_ON_GL_ERROR_GOTO(err);
+
+    glGenVertexArrays(1, &vao);
+    if (ensure_vao(vao)) goto err;
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof(float), 0);
+    glEnableVertexAttribArray(0);
+    // the instance attributes are pointed at the streaming buffer for each draw
+    for (GLuint i = 1; i <= 6; i++)
+    {
+        glEnableVertexAttribArray(i);
+        glVertexAttribDivisor(i, 1);
+    }
+    SLX_FAIL_ON_GL_ERROR_GOTO(err);
+
+    current_context->sprite_quad_vbo = vbo;
+    current_context->sprite_instance_vao = vao;
+    return false;
+err:
+    if (vao)
+    {
+        glDeleteVertexArrays(1, &vao);
+        clear_if_equal(current_context->current_vao, vao);
+    }
+    if (vbo)
+    {
+        glDeleteBuffers(1, &vbo);
+        clear_if_equal(current_context->current_vbo, vbo);
+    }
+    return true;
+}
+
+static inline uint8_t unorm8(float v)
+{
+    v = v < 0.0f ? 0.0f : v > 1.0f ? 1.0f : v;
+    return (uint8_t)(v * 255.0f + 0.5f);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SubmitSpriteInstances(P_IN sprite_desc* sprites, int32_t count, P_OUT int32_t* out_draw_calls)
+{
+    SLX_TIMED_CALL();
+
+    assert(sprites != nullptr);
+    assert(count >= 1);
+    assert(out_draw_calls != nullptr);
+
+    *out_draw_calls = 0;
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+    if (ensure_sprite_instancing()) return true;
+    SLX_FAIL_COND(count > INT32_MAX / (int32_t)sizeof(sprite_instance), error_code::invalid_parameter);
+
+    int32_t offset;
+    sprite_instance* instances = (sprite_instance*)stream_map(count * sizeof(sprite_instance), sizeof(sprite_instance), &offset);
+    if (instances == nullptr) return true;
+    for (int32_t i = 0; i < count; i++)
+    {
+        const sprite_desc& s = sprites[i];
+        instances[i] = sprite_instance{
+            s.x, s.y,
+            s.origin_x, s.origin_y,
+            s.width * s.scale_x, s.height * s.scale_y,
+            s.radians,
+            s.u0, s.v0, s.u1, s.v1,
+            unorm8(s.r), unorm8(s.g), unorm8(s.b), unorm8(s.a)
+        };
+    }
+    if (stream_unmap()) return true;
+
+    constexpr GLsizei stride = sizeof(sprite_instance);
+    int32_t begin = 0;
+    while (begin < count)
+    {
+        void* tex_handle = sprites[begin].tex_handle;
+        int32_t end = begin + 1;
+        while (end < count && sprites[end].tex_handle == tex_handle)
+            end++;
+
+        if (SLX_SetTexture(0, tex_handle)) return true;
+        if (apply_expected_state()) return true;
+        if (ensure_vao(current_context->sprite_instance_vao)) return true;
+        if (ensure_vbo(current_context->stream.vbo)) return true;
+
+        // no base instance in gl 3.3, so the instance pointers are moved to the run instead
+        s_byte* base = (s_byte*)(size_t)offset + (size_t)begin * stride;
+        glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride, base + offsetof(sprite_instance, x));
+        glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride, base + offsetof(sprite_instance, origin_x));
+        glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, stride, base + offsetof(sprite_instance, width));
+        glVertexAttribPointer(4, 1, GL_FLOAT, GL_FALSE, stride, base + offsetof(sprite_instance, radians));
+        glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, stride, base + offsetof(sprite_instance, u0));
+        glVertexAttribPointer(6, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride, base + offsetof(sprite_instance, r));
+        SLX_FAIL_ON_GL_ERROR();
+        glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, end - begin);
+        SLX_FAIL_ON_GL_ERROR();
+        count_draw(4, 0, end - begin);
+        (*out_draw_calls)++;
+        begin = end;
+    }
+    return false;
+}
+
+#pragma endregion
+
+SLX_API void* SLX_CALLCONV SLX_CreateTexture(int32_t width, int32_t height)
+{
+    SLX_TIMED_CALL();
+
+    assert(width >= 1);
+    assert(height >= 1);
+
+    GLuint tex;
+    glGenTextures(1, &tex);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    return pack(tex);
+
+failed:
+    if (tex) glDeleteTextures(1, &tex);
+    return nullptr;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureFilter(void* tex_handle, TextureFilterType min, TextureFilterType max)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    GLenum typeMin = TextureFilterType_to_gl(min);
+    GLenum typeMax = TextureFilterType_to_gl_mag(max);
+    SLX_FAIL_MAPENUM_COND(typeMin);
+    SLX_FAIL_MAPENUM_COND(typeMax);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, typeMin);
+    SLX_FAIL_ON_GL_ERROR();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, typeMax);
+    SLX_FAIL_ON_GL_ERROR();
+
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureWrap(void* tex_handle, TextureWrapType wrap)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    GLenum type = TextureWrapType_to_gl(wrap);
+    SLX_FAIL_MAPENUM_COND(type);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, type);
+    SLX_FAIL_ON_GL_ERROR();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, type);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+// TODO support more other formats
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureData(void* tex_handle, int32_t width, int32_t height, void* data, ImageFormat imageFormat)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(data != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    if (ImageFormat_is_compressed(imageFormat))
+    {
+        int64_t size = ImageFormat_get_data_size(imageFormat, width, height);
+        SLX_FAIL_COND(size > INT32_MAX, error_code::invalid_parameter);
+        glCompressedTexImage2D(GL_TEXTURE_2D, 0, ImageFormat_to_gl_sized(imageFormat), width, height, 0, (GLsizei)size, data);
+        SLX_FAIL_ON_GL_ERROR();
+        current_context->frame.texture_bytes += size;
+        return false;
+    }
+    int lineWidth = (width * ImageFormat_get_size(imageFormat));
+    int align = lineWidth % 8 == 0 ? 8 : lineWidth % 4 == 0 ? 4 : lineWidth % 2 == 0 ? 2 : 1;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, align);
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.texture_bytes += (int64_t)lineWidth * height;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_IsImageFormatSupported(ImageFormat imageFormat, P_OUT s_bool* out_supported)
+{
+    SLX_TIMED_CALL();
+
+    assert(out_supported != nullptr);
+
+    *out_supported = ImageFormat_is_supported(imageFormat);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureSubData(void* tex_handle, int32_t x, int32_t y, int32_t width, int32_t height, P_IN void* data, int32_t stride, ImageFormat imageFormat)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+    assert(x >= 0 && y >= 0);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(data != nullptr);
+
+    SLX_FAIL_COND(ImageFormat_is_compressed(imageFormat), error_code::invalid_parameter);
+    int pixelSize = ImageFormat_get_size(imageFormat);
+    // the rows may be spread further apart than 'width', as when the rect is cut out of a larger image
+    SLX_FAIL_COND(stride < width * pixelSize || stride % pixelSize != 0, error_code::invalid_parameter);
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    SLX_FAIL_MAPENUM_COND(format);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    int align = stride % 8 == 0 ? 8 : stride % 4 == 0 ? 4 : stride % 2 == 0 ? 2 : 1;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, align);
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, stride / pixelSize);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, width, height, format, GL_UNSIGNED_BYTE, data);
+    // every other upload expects tightly packed rows
+    glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.texture_bytes += (int64_t)width * pixelSize * height;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_AllocateTexture(void* tex_handle, int32_t width, int32_t height, int32_t mip_levels, ImageFormat imageFormat)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(mip_levels >= 1);
+
+    int32_t max_levels = 1;
+    while (((width | height) >> max_levels) != 0)
+        max_levels++;
+    SLX_FAIL_COND(mip_levels > max_levels, error_code::invalid_parameter);
+    bool compressed = ImageFormat_is_compressed(imageFormat);
+    SLX_FAIL_COND(compressed && ImageFormat_get_data_size(imageFormat, width, height) > INT32_MAX, error_code::invalid_parameter);
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    GLenum sized_format = ImageFormat_to_gl_sized(imageFormat);
+    SLX_FAIL_MAPENUM_COND(sized_format);
+    if (!compressed) SLX_FAIL_MAPENUM_COND(format);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    if (GLAD_GL_ARB_texture_storage)
+    {
+        glTexStorage2D(GL_TEXTURE_2D, mip_levels, sized_format, width, height);
+    }
+    else
+    {
+        for (int32_t level = 0; level < mip_levels; level++)
+        {
+            GLsizei w = width >> level, h = height >> level;
+            w = w ? w : 1;
+            h = h ? h : 1;
+            if (compressed)
+            {
+                GLsizei size = (GLsizei)ImageFormat_get_data_size(imageFormat, w, h);
+                glCompressedTexImage2D(GL_TEXTURE_2D, level, sized_format, w, h, 0, size, nullptr);
+            }
+            else
+            {
+                glTexImage2D(GL_TEXTURE_2D, level, sized_format, w, h, 0, format, GL_UNSIGNED_BYTE, nullptr);
+            }
+        }
+    }
+    // a shorter chain than 1 + log2(size) is only complete with the max level lowered
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, mip_levels - 1);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureLevelData(void* tex_handle, int32_t level, int32_t width, int32_t height, P_IN void* data, ImageFormat imageFormat)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+    assert(level >= 0);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(data != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    if (ImageFormat_is_compressed(imageFormat))
+    {
+        GLsizei size = (GLsizei)ImageFormat_get_data_size(imageFormat, width, height);
+        glCompressedTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, ImageFormat_to_gl_sized(imageFormat), size, data);
+        SLX_FAIL_ON_GL_ERROR();
+        current_context->frame.texture_bytes += size;
+        return false;
+    }
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    SLX_FAIL_MAPENUM_COND(format);
+    int lineWidth = (width * ImageFormat_get_size(imageFormat));
+    int align = lineWidth % 8 == 0 ? 8 : lineWidth % 4 == 0 ? 4 : lineWidth % 2 == 0 ? 2 : 1;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, align);
+    glTexSubImage2D(GL_TEXTURE_2D, level, 0, 0, width, height, format, GL_UNSIGNED_BYTE, data);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.texture_bytes += (int64_t)lineWidth * height;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GenerateMipmaps(void* tex_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    if (ensure_texture(tex))
+        return true;
+    glGenerateMipmap(GL_TEXTURE_2D);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteTexture(void* tex_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    glDeleteTextures(1, &tex);
+    SLX_FAIL_ON_GL_ERROR();
+    // deleting unbinds it from every unit
+    for (int32_t i = 0; i < max_texture_units; i++)
+    {
+        clear_if_equal(current_context->current_textures[i], tex);
+        clear_if_equal(current_context->expected_textures[i], tex);
+        clear_if_equal(current_context->current_texture_arrays[i], tex);
+        clear_if_equal(current_context->expected_texture_arrays[i], tex);
+    }
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTexture(int32_t index, void* tex_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(index >= 0);
+    assert(tex_handle != nullptr);
+    SLX_FAIL_COND(index >= max_texture_units, error_code::invalid_parameter);
+
+    GLuint tex = unpack(tex_handle);
+    if (current_context->recording_bundle)
+        return bundle_record_bind(bundle_op::set_texture, index, tex);
+
+    // bound by the next draw, and only if the unit doesn't hold it already
+    set_expected_texture(index, tex);
+    return false;
+}
+
+#pragma region texture upload
+
+constexpr int32_t upload_initial_size = 4 << 20;
+// pbo offsets handed to glTexImage2D stay aligned for any pixel size
+constexpr int32_t upload_alignment = 16;
+
+// blocks until the oldest pending upload has been read by the gpu and releases its range
+static s_bool upload_wait_oldest()
+{
+    upload_ring& ring = current_context->uploads;
+    pending_upload& up = ring.pending.front();
+    GLenum result;
+    do result = glClientWaitSync(up.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+    while (result == GL_TIMEOUT_EXPIRED);
+    glDeleteSync(up.fence);
+    ring.pending.pop_front();
+    SLX_FAIL_COND(result == GL_WAIT_FAILED, error_code::graphics_api_error);
+    return false;
+}
+
+// releases the ranges of the uploads the gpu is done with, without blocking
+static s_bool upload_retire_finished()
+{
+    upload_ring& ring = current_context->uploads;
+    while (!ring.pending.empty())
+    {
+        pending_upload& up = ring.pending.front();
+        GLenum result = glClientWaitSync(up.fence, 0, 0);
+        if (result == GL_TIMEOUT_EXPIRED)
+            break;
+        glDeleteSync(up.fence);
+        ring.pending.pop_front();
+        SLX_FAIL_COND(result == GL_WAIT_FAILED, error_code::graphics_api_error);
+    }
+    return false;
+}
+
+static s_bool upload_allocate(int32_t size)
+{
+    upload_ring& ring = current_context->uploads;
+    // the driver keeps the old storage alive until the uploads reading it are done,
+    // their fences stay pending for the tokens but no longer hold a range of the new buffer
+    for (pending_upload& up : ring.pending)
+        up.size = 0;
+    if (ring.pbo)
+        glDeleteBuffers(1, &ring.pbo);
+
+    glGenBuffers(1, &ring.pbo);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.pbo);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, size, nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    SLX_FAIL_ON_GL_ERROR();
+    ring.size = size;
+    ring.head = 0;
+    return false;
+}
+
+// hands out 'size' bytes of the ring, waiting only for uploads still reading that range
+static s_bool upload_reserve(int32_t size, P_OUT int32_t* out_offset)
+{
+    upload_ring& ring = current_context->uploads;
+    if (upload_retire_finished()) return true;
+    if (size > ring.size)
+    {
+        int64_t ring_size = ring.size ? (int64_t)ring.size * 2 : upload_initial_size;
+        while (ring_size < size)
+            ring_size *= 2;
+        SLX_FAIL_COND(ring_size > INT32_MAX, error_code::invalid_parameter);
+        if (upload_allocate((int32_t)ring_size)) return true;
+    }
+
+    int64_t offset = ((int64_t)ring.head + upload_alignment - 1) / upload_alignment * upload_alignment;
+    if (offset + size > ring.size)
+        offset = 0;
+    for (;;)
+    {
+        bool overlaps = false;
+        for (pending_upload& up : ring.pending)
+            overlaps |= up.offset < offset + size && offset < (int64_t)up.offset + up.size;
+        if (!overlaps)
+            break;
+        if (upload_wait_oldest()) return true;
+    }
+
+    ring.head = (int32_t)offset + size;
+    *out_offset = (int32_t)offset;
+    return false;
+}
+
+SLX_API int64_t SLX_CALLCONV SLX_SetTextureDataAsync(void* tex_handle, int32_t width, int32_t height, P_IN void* data, ImageFormat imageFormat)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(data != nullptr);
+
+    GLuint tex = unpack(tex_handle);
+    int lineWidth = (width * ImageFormat_get_size(imageFormat));
+    int64_t size = (int64_t)lineWidth * height;
+    SLX_FAIL_COND_RET(size > INT32_MAX, error_code::invalid_parameter, 0);
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    SLX_FAIL_MAPENUM_COND_RET(format, 0);
+
+    upload_ring& ring = current_context->uploads;
+    int32_t offset;
+    if (upload_reserve((int32_t)size, &offset))
+        return 0;
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.pbo);
+    // nothing pending reads this range anymore, so the map never stalls on the gpu
+    GLbitfield access = GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_INVALIDATE_RANGE_BIT;
+    void* ptr = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, offset, (GLsizeiptr)size, access);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    SLX_FAIL_COND_GOTO(ptr == nullptr, error_code::graphics_api_error, failed);
+    memcpy(ptr, data, (size_t)size);
+    glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    current_context->frame.texture_bytes += size;
+
+    if (ensure_texture(tex))
+        goto failed;
+    {
+        int align = lineWidth % 8 == 0 ? 8 : lineWidth % 4 == 0 ? 4 : lineWidth % 2 == 0 ? 2 : 1;
+        glPixelStorei(GL_UNPACK_ALIGNMENT, align);
+        // with a pixel unpack buffer bound the pointer is an offset into it, the copy happens on the gpu timeline
+        glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, (void*)(intptr_t)offset);
+        SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    }
+    // unbound again, so the other pixel uploads read client memory instead of the ring
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    {
+        GLsync fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        SLX_FAIL_COND_RET(fence == nullptr, error_code::graphics_api_error, 0);
+        ring.pending.push_back({ ++ring.last_token, offset, (int32_t)size, fence });
+    }
+    return ring.last_token;
+
+failed:
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    return 0;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_IsUploadComplete(int64_t token, P_OUT s_bool* out_complete)
+{
+    SLX_TIMED_CALL();
+
+    assert(token >= 1);
+    assert(out_complete != nullptr);
+
+    upload_ring& ring = current_context->uploads;
+    SLX_FAIL_COND(token > ring.last_token, error_code::invalid_parameter);
+    if (upload_retire_finished()) return true;
+    // tokens are handed out in order and retired oldest first
+    *out_complete = ring.pending.empty() || token < ring.pending.front().token;
+    return false;
+}
+
+#pragma endregion
+
+#pragma region texture atlas
+
+// empty border around every image, filled with its edge pixels so linear filtering doesn't bleed
+constexpr int32_t atlas_padding = 1;
+
+// the y a 'width' by 'height' rect would sit at from node 'index', -1 if it doesn't fit
+static int32_t skyline_fit(const std::vector<skyline_node>& skyline, size_t index, int32_t width, int32_t height, int32_t page_size)
+{
+    if (skyline[index].x + width > page_size)
+        return -1;
+    int32_t y = skyline[index].y;
+    int32_t width_left = width;
+    for (size_t i = index; width_left > 0; i++)
+    {
+        if (i >= skyline.size())
+            return -1;
+        if (skyline[i].y > y)
+            y = skyline[i].y;
+        if (y + height > page_size)
+            return -1;
+        width_left -= skyline[i].width;
+    }
+    return y;
+}
+
+// bottom-left skyline packing, returns false if the page is too full
+static bool skyline_pack(std::vector<skyline_node>& skyline, int32_t width, int32_t height, int32_t page_size, P_OUT int32_t* out_x, P_OUT int32_t* out_y)
+{
+    size_t best = skyline.size();
+    int32_t best_bottom = page_size + 1;
+    int32_t best_width = page_size + 1;
+    for (size_t i = 0; i < skyline.size(); i++)
+    {
+        int32_t y = skyline_fit(skyline, i, width, height, page_size);
+        if (y == -1)
+            continue;
+        if (y + height < best_bottom || (y + height == best_bottom && skyline[i].width < best_width))
+        {
+            best = i;
+            best_bottom = y + height;
+            best_width = skyline[i].width;
+        }
+    }
+    if (best == skyline.size())
+        return false;
+
+    *out_x = skyline[best].x;
+    *out_y = best_bottom - height;
+    skyline.insert(skyline.begin() + best, skyline_node{ *out_x, best_bottom, width });
+
+    // cut the nodes now below the new one
+    for (size_t i = best + 1; i < skyline.size();)
+    {
+        int32_t covered = skyline[i - 1].x + skyline[i - 1].width - skyline[i].x;
+        if (covered <= 0)
+            break;
+        skyline[i].x += covered;
+        skyline[i].width -= covered;
+        if (skyline[i].width > 0)
+            break;
+        skyline.erase(skyline.begin() + i);
+    }
+    for (size_t i = 0; i + 1 < skyline.size();)
+    {
+        if (skyline[i].y == skyline[i + 1].y)
+        {
+            skyline[i].width += skyline[i + 1].width;
+            skyline.erase(skyline.begin() + i + 1);
+        }
+        else
+            i++;
+    }
+    return true;
+}
+
+static s_bool atlas_add_page(texture_atlas_handle* atlas)
+{
+    GLuint tex = 0;
+    glGenTextures(1, &tex);
+    SLX_FAIL_ON_GL_ERROR();
+    atlas->pages.push_back(atlas_page{ tex, { skyline_node{ 0, 0, atlas->page_size } } });
+    if (ensure_texture(tex))
+        return true;
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, atlas->page_size, atlas->page_size, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, atlas->min_filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, atlas->mag_filter);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+SLX_API texture_atlas_handle* SLX_CALLCONV SLX_CreateTextureAtlas(int32_t page_size, TextureFilterType filter_type)
+{
+    SLX_TIMED_CALL();
+
+    assert(page_size >= 1);
+
+    GLenum filter = TextureFilterType_to_gl(filter_type);
+    SLX_FAIL_MAPENUM_COND_NULL(filter);
+    SLX_FAIL_COND_NULL(TextureFilterType_uses_mipmaps(filter_type), error_code::invalid_parameter);
+    texture_atlas_handle* atlas = new texture_atlas_handle();
+    atlas->page_size = page_size;
+    atlas->min_filter = filter;
+    atlas->mag_filter = TextureFilterType_to_gl_mag(filter_type);
+    return atlas;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_AddAtlasImage(P_IN texture_atlas_handle* atlas, int32_t width, int32_t height, P_IN void* data, ImageFormat imageFormat, P_OUT atlas_region* out_region)
+{
+    SLX_TIMED_CALL();
+
+    assert(atlas != nullptr);
+    assert(data != nullptr);
+    assert(out_region != nullptr);
+
+    int32_t padded_width = width + atlas_padding * 2;
+    int32_t padded_height = height + atlas_padding * 2;
+    SLX_FAIL_COND(width < 1 || height < 1, error_code::invalid_parameter);
+    SLX_FAIL_COND(padded_width > atlas->page_size || padded_height > atlas->page_size, error_code::invalid_parameter);
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    SLX_FAIL_MAPENUM_COND(format);
+
+    // earlier pages are tried first so they fill up before new ones are touched
+    int32_t x = 0, y = 0;
+    size_t page = 0;
+    while (page < atlas->pages.size() && !skyline_pack(atlas->pages[page].skyline, padded_width, padded_height, atlas->page_size, &x, &y))
+        page++;
+    if (page == atlas->pages.size())
+    {
+        if (atlas_add_page(atlas))
+            return true;
+        bool packed = skyline_pack(atlas->pages[page].skyline, padded_width, padded_height, atlas->page_size, &x, &y);
+        assert(packed);
+        (void)packed;
+    }
+
+    // copy with the edge pixels extruded into the padding
+    int32_t pixel_size = ImageFormat_get_size(imageFormat);
+    std::vector<s_byte> padded((size_t)padded_width * padded_height * pixel_size);
+    const s_byte* src = (const s_byte*)data;
+    for (int32_t py = 0; py < padded_height; py++)
+    {
+        int32_t sy = py - atlas_padding;
+        sy = sy < 0 ? 0 : sy >= height ? height - 1 : sy;
+        s_byte* dst_row = padded.data() + (size_t)py * padded_width * pixel_size;
+        const s_byte* src_row = src + (size_t)sy * width * pixel_size;
+        for (int32_t p = 0; p < atlas_padding; p++)
+        {
+            memcpy(dst_row + p * pixel_size, src_row, pixel_size);
+            memcpy(dst_row + (atlas_padding + width + p) * pixel_size, src_row + (width - 1) * pixel_size, pixel_size);
+        }
+        memcpy(dst_row + atlas_padding * pixel_size, src_row, (size_t)width * pixel_size);
+    }
+
+    GLuint tex = atlas->pages[page].tex;
+    if (ensure_texture(tex))
+        return true;
+    int lineWidth = padded_width * pixel_size;
+    int align = lineWidth % 8 == 0 ? 8 : lineWidth % 4 == 0 ? 4 : lineWidth % 2 == 0 ? 2 : 1;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, align);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, padded_width, padded_height, format, GL_UNSIGNED_BYTE, padded.data());
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.texture_bytes += padded.size();
+
+    float size = (float)atlas->page_size;
+    out_region->tex_handle = pack(tex);
+    out_region->x = x + atlas_padding;
+    out_region->y = y + atlas_padding;
+    out_region->u0 = out_region->x / size;
+    out_region->v0 = out_region->y / size;
+    out_region->u1 = (out_region->x + width) / size;
+    out_region->v1 = (out_region->y + height) / size;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteTextureAtlas(P_IN texture_atlas_handle* atlas)
+{
+    SLX_TIMED_CALL();
+
+    assert(atlas != nullptr);
+
+    for (atlas_page& page : atlas->pages)
+    {
+        if (SLX_DeleteTexture(pack(page.tex)))
+            return true;
+    }
+    delete atlas;
+    return false;
+}
+
+#pragma endregion
+
+#pragma region texture array
+
+// same sized layers sampled with one sampler2DArray, so sprites from different sheets share a draw
+SLX_API void* SLX_CALLCONV SLX_CreateTextureArray(int32_t width, int32_t height, int32_t layers, ImageFormat imageFormat, TextureFilterType filter_type, TextureWrapType wrap_type)
+{
+    SLX_TIMED_CALL();
+
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(layers >= 1);
+
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    SLX_FAIL_MAPENUM_COND_NULL(format);
+    GLenum filter = TextureFilterType_to_gl(filter_type);
+    SLX_FAIL_MAPENUM_COND_NULL(filter);
+    // there are no mip levels to sample
+    SLX_FAIL_COND_NULL(TextureFilterType_uses_mipmaps(filter_type), error_code::invalid_parameter);
+    GLenum wrap = TextureWrapType_to_gl(wrap_type);
+    SLX_FAIL_MAPENUM_COND_NULL(wrap);
+
+    GLuint tex = 0;
+    glGenTextures(1, &tex);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    if (ensure_texture_array(tex)) goto failed;
+    glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, format, width, height, layers, 0, format, GL_UNSIGNED_BYTE, nullptr);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    // there are no mipmaps, the default min filter would leave it incomplete
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, filter);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, TextureFilterType_to_gl_mag(filter_type));
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, wrap);
+    glTexParameteri(GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, wrap);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    return pack(tex);
+
+failed:
+    if (tex)
+    {
+        glDeleteTextures(1, &tex);
+        for (int32_t i = 0; i < max_texture_units; i++)
+            clear_if_equal(current_context->current_texture_arrays[i], tex);
+    }
+    return nullptr;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureArrayLayer(void* tex_handle, int32_t layer, int32_t width, int32_t height, void* data, ImageFormat imageFormat)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+    assert(layer >= 0);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(data != nullptr);
+
+    if (ensure_texture_array(unpack(tex_handle)))
+        return true;
+    int lineWidth = (width * ImageFormat_get_size(imageFormat));
+    int align = lineWidth % 8 == 0 ? 8 : lineWidth % 4 == 0 ? 4 : lineWidth % 2 == 0 ? 2 : 1;
+    glPixelStorei(GL_UNPACK_ALIGNMENT, align);
+    GLenum format = ImageFormat_to_gl(imageFormat);
+    SLX_FAIL_MAPENUM_COND(format);
+    glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer, width, height, 1, format, GL_UNSIGNED_BYTE, data);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.texture_bytes += (int64_t)lineWidth * height;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureArray(int32_t index, void* tex_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(index >= 0);
+    assert(tex_handle != nullptr);
+    SLX_FAIL_COND(index >= max_texture_units, error_code::invalid_parameter);
+
+    GLuint tex = unpack(tex_handle);
+    if (current_context->recording_bundle)
+        return bundle_record_bind(bundle_op::set_texture_array, index, tex);
+
+    set_expected_texture_array(index, tex);
+    return false;
+}
+
+#pragma endregion
+
+#pragma region uniform buffer
+
+// returns -1 when every binding point is taken
+static int32_t uniform_block_binding(const char* name)
+{
+    std::vector<std::string>& names = current_context->uniform_block_names;
+    for (size_t i = 0; i < names.size(); i++)
+    {
+        if (names[i] == name)
+            return (int32_t)i;
+    }
+    if ((int32_t)names.size() >= max_uniform_bindings)
+        return -1;
+    names.emplace_back(name);
+    return (int32_t)names.size() - 1;
+}
+
+// blocks with the same name get the same binding point in every program,
+// so a buffer bound once per frame serves all of them
+static s_bool assign_uniform_block_bindings(GLuint prog)
+{
+    GLint blocks = 0;
+    glGetProgramiv(prog, GL_ACTIVE_UNIFORM_BLOCKS, &blocks);
+    SLX_FAIL_ON_GL_ERROR();
+    for (GLint i = 0; i < blocks; i++)
+    {
+        char name[256];
+        glGetActiveUniformBlockName(prog, i, sizeof(name), nullptr, name);
+        SLX_FAIL_ON_GL_ERROR();
+        int32_t binding = uniform_block_binding(name);
+        SLX_FAIL_COND(binding == -1, error_code::uniform_bindings_exhausted);
+        glUniformBlockBinding(prog, i, binding);
+        SLX_FAIL_ON_GL_ERROR();
+    }
+    return false;
+}
+
+SLX_API uniform_buffer_handle* SLX_CALLCONV SLX_CreateUniformBuffer(int32_t size, VertexBufferDataUsage data_usage)
+{
+    SLX_TIMED_CALL();
+
+    assert(size >= 1);
+
+    GLenum usage = VertexBufferDataUsage_to_gl(data_usage);
+    SLX_FAIL_MAPENUM_COND_NULL(usage);
+    GLuint ubo = 0;
+    glGenBuffers(1, &ubo);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    if (ensure_ubo(ubo)) goto failed;
+    glBufferData(GL_UNIFORM_BUFFER, size, nullptr, usage);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    {
+        uniform_buffer_handle* buffer = new uniform_buffer_handle();
+        buffer->ubo = ubo;
+        buffer->size = size;
+        return buffer;
+    }
+failed:
+    if (ubo)
+    {
+        glDeleteBuffers(1, &ubo);
+        clear_if_equal(current_context->current_ubo, ubo);
+    }
+    return nullptr;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetUniformBufferData(P_IN uniform_buffer_handle* buffer, int32_t offset, P_IN void* data, int32_t size)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    assert(data != nullptr);
+    SLX_FAIL_COND(offset < 0 || size < 1 || size > buffer->size - offset, error_code::invalid_parameter);
+
+    if (ensure_ubo(buffer->ubo)) return true;
+    glBufferSubData(GL_UNIFORM_BUFFER, offset, size, data);
+    SLX_FAIL_ON_GL_ERROR();
+    current_context->frame.buffer_bytes += size;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_BindUniformBuffer(int32_t binding, P_IN uniform_buffer_handle* buffer)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+    SLX_FAIL_COND(binding < 0 || binding >= max_uniform_bindings, error_code::invalid_parameter);
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    return ensure_uniform_buffer(binding, buffer->ubo);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteUniformBuffer(P_IN uniform_buffer_handle* buffer)
+{
+    SLX_TIMED_CALL();
+
+    assert(buffer != nullptr);
+
+    glDeleteBuffers(1, &buffer->ubo);
+    SLX_FAIL_ON_GL_ERROR();
+    clear_if_equal(current_context->current_ubo, buffer->ubo);
+    for (int32_t i = 0; i < max_uniform_bindings; i++)
+        clear_if_equal(current_context->current_uniform_buffers[i], buffer->ubo);
+    delete buffer;
+    return false;
+}
+
+SLX_API int32_t SLX_CALLCONV SLX_GetUniformBlockBinding(const char* name_utf8)
+{
+    SLX_TIMED_CALL();
+
+    assert(name_utf8 != nullptr);
+
+    int32_t binding = uniform_block_binding(name_utf8);
+    SLX_FAIL_COND_RET(binding == -1, error_code::uniform_bindings_exhausted, -1);
+    return binding;
+}
+
+#pragma endregion
+
+#pragma region program cache
+
+constexpr uint32_t program_cache_magic = 0x50584c53; // "SLXP"
+constexpr uint64_t fnv1a_basis = 0xcbf29ce484222325ull;
+
+// ahead of the driver's binary in a cache file
+struct program_cache_header
+{
+    uint32_t magic;
+    GLenum format;
+    uint64_t key;
+    GLsizei length;
+    int32_t reserved;
+};
+
+// the terminator is hashed too, so moving text from one string to the next changes the hash
+static uint64_t fnv1a(uint64_t hash, const char* str)
+{
+    for (const char* p = str; ; p++)
+    {
+        hash = (hash ^ (uint8_t)*p) * 0x100000001b3ull;
+        if (*p == '\0')
+            return hash;
+    }
+}
+
+static std::wstring program_cache_path(uint64_t key, const wchar_t* extension)
+{
+    wchar_t name[32];
+    swprintf(name, 32, L"%016llx%ls", (unsigned long long)key, extension);
+    return current_context->programs.directory + name;
+}
+
+// 0 if there is no usable entry, the program is compiled from source then
+static GLuint program_cache_load(uint64_t key)
+{
+    std::wstring path = program_cache_path(key, L".bin");
+    FILE* file = _wfopen(path.c_str(), L"rb");
+    if (file == nullptr)
+        return 0;
+    program_cache_header header;
+    std::vector<s_byte> binary;
+    bool read = fread(&header, sizeof(header), 1, file) == 1
+        && header.magic == program_cache_magic && header.key == key && header.length > 0;
+    if (read)
+    {
+        binary.resize((size_t)header.length);
+        read = fread(binary.data(), 1, binary.size(), file) == binary.size();
+    }
+    fclose(file);
+    if (!read)
+        return 0;
+
+    GLuint prog = glCreateProgram();
+    glProgramBinary(prog, header.format, binary.data(), header.length);
+    GLint linked = GL_FALSE;
+    glGetProgramiv(prog, GL_LINK_STATUS, &linked);
+    if (linked != GL_TRUE)
+    {
+        // drivers may reject any binary, the GL_INVALID_ENUM of a dropped format is consumed here
+        glGetError();
+        glDeleteProgram(prog);
+        return 0;
+    }
+    return prog;
+}
+
+// failing to write only costs the next launch a compile, so nothing is reported
+static void program_cache_store(GLuint prog, uint64_t key)
+{
+    GLint length = 0;
+    glGetProgramiv(prog, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0)
+        return;
+    std::vector<s_byte> binary((size_t)length);
+    program_cache_header header = { program_cache_magic, 0, key, 0, 0 };
+    glGetProgramBinary(prog, length, &header.length, &header.format, binary.data());
+    if (header.length <= 0)
+        return;
+
+    // written aside and renamed, so a crash or another instance never leaves a torn entry
+    std::wstring temp = program_cache_path(key, L".tmp");
+    std::wstring path = program_cache_path(key, L".bin");
+    FILE* file = _wfopen(temp.c_str(), L"wb");
+    if (file == nullptr)
+        return;
+    bool written = fwrite(&header, sizeof(header), 1, file) == 1
+        && fwrite(binary.data(), 1, (size_t)header.length, file) == (size_t)header.length;
+    written = fclose(file) == 0 && written;
+    _wremove(path.c_str());
+    if (!written || _wrename(temp.c_str(), path.c_str()) != 0)
+        _wremove(temp.c_str());
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetProgramCacheDirectory(P_IN wchar_t* directory, P_OUT s_bool* out_enabled)
+{
+    SLX_TIMED_CALL();
+
+    assert(out_enabled != nullptr);
+
+    program_cache& cache = current_context->programs;
+    cache.directory.clear();
+    *out_enabled = false;
+    if (directory == nullptr || directory[0] == L'\0')
+        return false;
+    GLint formats = 0;
+    if (GLAD_GL_ARB_get_program_binary)
+        glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+    SLX_FAIL_ON_GL_ERROR();
+    // some drivers expose the extension without a single format to save in
+    if (formats == 0)
+        return false;
+
+    const GLenum driver_strings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+    uint64_t hash = fnv1a_basis;
+    for (GLenum name : driver_strings)
+    {
+        const char* str = (const char*)glGetString(name);
+        hash = fnv1a(hash, str ? str : "");
+    }
+    cache.driver_hash = hash;
+    cache.directory = directory;
+    wchar_t last = cache.directory.back();
+    if (last != L'\\' && last != L'/')
+        cache.directory += L'\\';
+    *out_enabled = true;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_GetProgramCacheStats(P_OUT program_cache_stats* out_stats)
+{
+    assert(out_stats != nullptr);
+
+    *out_stats = current_context->programs.stats;
+    return false;
+}
+
+#pragma endregion
+
+#pragma region shader build
+
+// fills the tables and tags the cached uniform slots with their declared types
+static s_bool shader_reflect(shader_handle* shader)
+{
+    GLuint prog = shader->program;
+    GLint blocks = 0, uniforms = 0;
+    glGetProgramiv(prog, GL_ACTIVE_UNIFORM_BLOCKS, &blocks);
+    glGetProgramiv(prog, GL_ACTIVE_UNIFORMS, &uniforms);
+    SLX_FAIL_ON_GL_ERROR();
+
+    shader->block_table.resize((size_t)blocks);
+    for (GLint i = 0; i < blocks; i++)
+    {
+        shader_uniform_block_info& info = shader->block_table[i];
+        glGetActiveUniformBlockName(prog, i, sizeof(info.name), nullptr, info.name);
+        glGetActiveUniformBlockiv(prog, i, GL_UNIFORM_BLOCK_BINDING, &info.binding);
+        glGetActiveUniformBlockiv(prog, i, GL_UNIFORM_BLOCK_DATA_SIZE, &info.data_size);
+    }
+
+    shader->uniform_table.resize((size_t)uniforms);
+    for (GLint i = 0; i < uniforms; i++)
+    {
+        shader_uniform_info& info = shader->uniform_table[i];
+        GLuint index = (GLuint)i;
+        glGetActiveUniform(prog, index, sizeof(info.name), nullptr, &info.size, &info.type, info.name);
+        glGetActiveUniformsiv(prog, 1, &index, GL_UNIFORM_BLOCK_INDEX, &info.block);
+        glGetActiveUniformsiv(prog, 1, &index, GL_UNIFORM_OFFSET, &info.offset);
+        info.location = info.block == -1 ? glGetUniformLocation(prog, info.name) : -1;
+        if (info.location >= 0 && info.location < max_cached_uniform_location)
+        {
+            if ((size_t)info.location >= shader->uniforms.size())
+                shader->uniforms.resize((size_t)info.location + 1);
+            shader->uniforms[info.location].declared_type = info.type;
+        }
+    }
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+// with KHR_parallel_shader_compile the driver compiles and links on its own threads, the result is checked by shader_finish
+static shader_handle* shader_begin(const char* vert_source, const char* frag_source)
+{
+    program_cache& cache = current_context->programs;
+    shader_handle* shader = new shader_handle();
+    if (!cache.directory.empty())
+    {
+        shader->cache_key = fnv1a(fnv1a(cache.driver_hash, vert_source), frag_source);
+        shader->program = program_cache_load(shader->cache_key);
+        if (shader->program)
+        {
+            cache.stats.hits++;
+            if (assign_uniform_block_bindings(shader->program) || shader_reflect(shader))
+                shader->status = last_error_code;
+            return shader;
+        }
+        cache.stats.misses++;
+        shader->cache_store = true;
+    }
+
+    shader->vert = glCreateShader(GL_VERTEX_SHADER);
+    shader->frag = glCreateShader(GL_FRAGMENT_SHADER);
+    glShaderSource(shader->vert, 1, &vert_source, nullptr);
+    glShaderSource(shader->frag, 1, &frag_source, nullptr);
+    glCompileShader(shader->vert);
+    glCompileShader(shader->frag);
+    shader->program = glCreateProgram();
+    glAttachShader(shader->program, shader->vert);
+    glAttachShader(shader->program, shader->frag);
+    if (shader->cache_store)
+        glProgramParameteri(shader->program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    glLinkProgram(shader->program);
+    SLX_FAIL_ON_GL_ERROR_GOTO(err);
+    return shader;
+err:
+    glDeleteShader(shader->vert);
+    glDeleteShader(shader->frag);
+    glDeleteProgram(shader->program);
+    delete shader;
+    return nullptr;
+}
+
+static void append_shader_log(std::string& log, const char* stage, GLuint obj, bool is_program)
+{
+    GLint length = 0;
+    if (is_program)
+        glGetProgramiv(obj, GL_INFO_LOG_LENGTH, &length);
+    else
+        glGetShaderiv(obj, GL_INFO_LOG_LENGTH, &length);
+    if (length <= 1)
+        return;
+    std::vector<char> text((size_t)length);
+    if (is_program)
+        glGetProgramInfoLog(obj, length, nullptr, text.data());
+    else
+        glGetShaderInfoLog(obj, length, nullptr, text.data());
+    log += "[";
+    log += stage;
+    log += "]\n";
+    log += text.data();
+    if (log.back() != '\n')
+        log += '\n';
+}
+
+// blocks if the driver is still working, every use of the shader goes through here first
+static s_bool shader_finish(shader_handle* shader)
+{
+    if (shader->vert != 0)
+    {
+        GLint vert_compiled = GL_FALSE, frag_compiled = GL_FALSE, linked = GL_FALSE;
+        glGetShaderiv(shader->vert, GL_COMPILE_STATUS, &vert_compiled);
+        glGetShaderiv(shader->frag, GL_COMPILE_STATUS, &frag_compiled);
+        glGetProgramiv(shader->program, GL_LINK_STATUS, &linked);
+        append_shader_log(shader->log, "vertex", shader->vert, false);
+        append_shader_log(shader->log, "fragment", shader->frag, false);
+        append_shader_log(shader->log, "link", shader->program, true);
+        glDetachShader(shader->program, shader->vert);
+        glDetachShader(shader->program, shader->frag);
+        glDeleteShader(shader->vert);
+        glDeleteShader(shader->frag);
+        shader->vert = shader->frag = 0;
+#ifdef SLX_DEBUG
+        if (!shader->log.empty())
+            printf("[shader] %s", shader->log.c_str());
+#endif
+
+        if (vert_compiled != GL_TRUE || frag_compiled != GL_TRUE)
+            shader->status = error_code::shader_compile_failed;
+        else if (linked != GL_TRUE)
+            shader->status = error_code::shader_link_failed;
+        else if (shader->cache_store)
+            program_cache_store(shader->program, shader->cache_key);
+        // the stages are gone already, so a failure here has to stick to the shader too
+        SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+        if (shader->status == error_code::ok && (assign_uniform_block_bindings(shader->program) || shader_reflect(shader)))
+            goto failed;
+    }
+    SLX_FAIL_COND(shader->status != error_code::ok, shader->status);
+    return false;
+
+failed:
+    if (shader->status == error_code::ok)
+        shader->status = last_error_code;
+    return true;
+}
+
+static void shader_delete(shader_handle* shader)
+{
+    if (shader->vert != 0)
+    {
+        glDeleteShader(shader->vert);
+        glDeleteShader(shader->frag);
+    }
+    glDeleteProgram(shader->program);
+    delete shader;
+}
+
+// finished by SLX_IsShaderReady/SLX_WaitShader, a failed build keeps its log until the shader is deleted
+SLX_API shader_handle* SLX_CALLCONV SLX_CreateShaderAsync(const char* vert_source, const char* frag_source)
+{
+    SLX_TIMED_CALL();
+
+    assert(vert_source != nullptr);
+    assert(frag_source != nullptr);
+
+    return shader_begin(vert_source, frag_source);
+}
+
+// also reports a failed build, the log tells why
+SLX_API s_bool SLX_CALLCONV SLX_IsShaderReady(P_IN shader_handle* shader, P_OUT s_bool* out_ready)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+    assert(out_ready != nullptr);
+
+    *out_ready = false;
+    if (shader->vert != 0 && GLAD_GL_KHR_parallel_shader_compile)
+    {
+        GLint completed = GL_FALSE;
+        glGetProgramiv(shader->program, GL_COMPLETION_STATUS_KHR, &completed);
+        SLX_FAIL_ON_GL_ERROR();
+        if (completed != GL_TRUE)
+            return false;
+    }
+    if (shader_finish(shader))
+        return true;
+    *out_ready = true;
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_WaitShader(P_IN shader_handle* shader)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+
+    return shader_finish(shader);
+}
+
+// returns the length of the whole log, which is empty until the shader is ready
+SLX_API int32_t SLX_CALLCONV SLX_GetShaderLog(P_IN shader_handle* shader, P_OUT char* out_log, int32_t capacity)
+{
+    assert(shader != nullptr);
+    assert(capacity >= 0);
+
+    const std::string& log = shader->log;
+    if (out_log != nullptr && capacity > 0)
+    {
+        size_t count = log.size() < (size_t)capacity - 1 ? log.size() : (size_t)capacity - 1;
+        memcpy(out_log, log.data(), count);
+        out_log[count] = '\0';
+    }
+    return (int32_t)log.size();
+}
+
+// 'count' -1 leaves the choice to the driver, 0 compiles on the calling thread
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderCompilerThreads(int32_t count, P_OUT s_bool* out_supported)
+{
+    SLX_TIMED_CALL();
+
+    assert(count >= -1);
+    assert(out_supported != nullptr);
+
+    *out_supported = GLAD_GL_KHR_parallel_shader_compile != 0;
+    if (!*out_supported)
+        return false;
+    glMaxShaderCompilerThreadsKHR(count == -1 ? 0xffffffffu : (GLuint)count);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
+}
+
+#pragma endregion
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteShader(P_IN shader_handle* shader)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+
+    GLuint prog = shader->program;
+    shader_delete(shader);
+    SLX_FAIL_ON_GL_ERROR();
+    clear_if_equal(current_context->current_shader, prog);
+    clear_if_equal(current_context->expected_shader, prog);
+
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShader(P_IN shader_handle* shader)
+{
+    SLX_TIMED_CALL();
+
+    // null to use default render pipeline
+    if (shader && shader_finish(shader))
+        return true;
+    GLuint prog = shader ? shader->program : 0;
+    if (current_context->recording_bundle)
+        return bundle_record_bind(bundle_op::set_shader, 0, prog);
+
+    ensure_shader(prog);
+    current_context->expected_shader = prog;
+    return false;
+}
+
+SLX_API void* SLX_CALLCONV SLX_CreateSampler(TextureFilterType filter_type, TextureWrapType wrap_type)
+{
+    SLX_TIMED_CALL();
+
+    GLuint sampler = 0;
+    glGenSamplers(1, &sampler);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+
+    GLenum filter = TextureFilterType_to_gl(filter_type);
+    SLX_FAIL_MAPENUM_COND_GOTO(filter, failed);
+    glSamplerParameteri(sampler, GL_TEXTURE_MIN_FILTER, filter);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    glSamplerParameteri(sampler, GL_TEXTURE_MAG_FILTER, TextureFilterType_to_gl_mag(filter_type));
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+
+    GLenum wrap = TextureWrapType_to_gl(wrap_type);
+    SLX_FAIL_MAPENUM_COND_GOTO(wrap, failed);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_S, wrap);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    glSamplerParameteri(sampler, GL_TEXTURE_WRAP_T, wrap);
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+
+    return pack(sampler);
+failed:
+    if (sampler) glDeleteSamplers(1, &sampler);
+    return nullptr;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetSampler(int32_t index, void* sampler_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(index >= 0);
+    assert(sampler_handle != nullptr);
+    SLX_FAIL_COND(index >= max_texture_units, error_code::invalid_parameter);
+
+    if (current_context->recording_bundle)
+        return bundle_record_bind(bundle_op::set_sampler, index, unpack(sampler_handle));
+
+    return ensure_sampler(index, unpack(sampler_handle));
+}
+
+// TODO
+SLX_API s_bool SLX_CALLCONV SLX_DeleteSampler(void* sampler_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(sampler_handle != nullptr);
+
+    GLuint sampler = unpack(sampler_handle);
+    glDeleteSamplers(1, &sampler);
+    SLX_FAIL_ON_GL_ERROR();
+    for (int32_t i = 0; i < max_texture_units; i++)
+        clear_if_equal(current_context->current_samplers[i], sampler);
+    return false;
+}
+
+#pragma region uniform
+
+// both return the length of the whole table, -1 if the shader failed to build
+SLX_API int32_t SLX_CALLCONV SLX_GetShaderUniforms(P_IN shader_handle* shader, P_OUT shader_uniform_info* out_uniforms, int32_t capacity)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+    assert(capacity >= 0);
+
+    if (shader_finish(shader))
+        return -1;
+    const std::vector<shader_uniform_info>& table = shader->uniform_table;
+    if (out_uniforms != nullptr && capacity > 0)
+        memcpy(out_uniforms, table.data(), (table.size() < (size_t)capacity ? table.size() : (size_t)capacity) * sizeof(shader_uniform_info));
+    return (int32_t)table.size();
+}
+
+SLX_API int32_t SLX_CALLCONV SLX_GetShaderUniformBlocks(P_IN shader_handle* shader, P_OUT shader_uniform_block_info* out_blocks, int32_t capacity)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+    assert(capacity >= 0);
+
+    if (shader_finish(shader))
+        return -1;
+    const std::vector<shader_uniform_block_info>& table = shader->block_table;
+    if (out_blocks != nullptr && capacity > 0)
+        memcpy(out_blocks, table.data(), (table.size() < (size_t)capacity ? table.size() : (size_t)capacity) * sizeof(shader_uniform_block_info));
+    return (int32_t)table.size();
+}
+
+SLX_API int SLX_CALLCONV SLX_GetShaderParamLocation(P_IN shader_handle* shader, const char* name_utf8)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+
+    if (shader_finish(shader))
+        return -2;
+    int ret = glGetUniformLocation(shader->program, name_utf8);
+    SLX_FAIL_ON_GL_ERROR_RET(-2);
+    return ret;
+}
+
+static s_bool set_shader_param(shader_handle* shader, int32_t loc, uniform_type type, const void* values)
+{
+    assert(shader != nullptr);
+    assert(loc != -1);
+
+    if (shader_finish(shader))
+        return true;
+    if (current_context->recording_bundle)
+        return bundle_record_uniform(shader, loc, type, values);
+    return set_uniform(shader, loc, type, values);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamInt(P_IN shader_handle* shader, int32_t loc, int32_t value)
+{
+    SLX_TIMED_CALL();
+
+    return set_shader_param(shader, loc, uniform_type::int1, &value);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamFloat(P_IN shader_handle* shader, int32_t loc, float value)
+{
+    SLX_TIMED_CALL();
+
+    return set_shader_param(shader, loc, uniform_type::float1, &value);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamVec4(P_IN shader_handle* shader, int32_t loc, P_IN float* vec)
+{
+    SLX_TIMED_CALL();
+
+    return set_shader_param(shader, loc, uniform_type::vec4, vec);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat4(P_IN shader_handle* shader, int32_t loc, P_IN float* mat)
+{
+    SLX_TIMED_CALL();
+
+    return set_shader_param(shader, loc, uniform_type::mat4, mat);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat3x2(P_IN shader_handle* shader, int32_t loc, P_IN float* mat)
+{
+    SLX_TIMED_CALL();
+
+    return set_shader_param(shader, loc, uniform_type::mat3x2, mat);
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParams(P_IN shader_handle* shader, P_IN void* data, int32_t size)
+{
+    SLX_TIMED_CALL();
+
+    assert(shader != nullptr);
+    assert(data != nullptr);
+    assert(size >= 0);
+
+    const s_byte* p = (const s_byte*)data;
+    const s_byte* end = p + size;
+    while (p < end)
+    {
+        SLX_FAIL_COND((size_t)(end - p) < sizeof(shader_param_entry), error_code::invalid_parameter);
+        shader_param_entry entry;
+        memcpy(&entry, p, sizeof(entry));
+        p += sizeof(entry);
+
+        size_t values_size = uniform_type_components(entry.type) * sizeof(float);
+        SLX_FAIL_COND(values_size == 0 || (size_t)(end - p) < values_size, error_code::invalid_parameter);
+        float values[16];
+        memcpy(values, p, values_size);
+        p += values_size;
+
+        if (set_shader_param(shader, entry.location, entry.type, values))
+            return true;
+    }
+    return false;
+}
+
+#pragma endregion
+
+SLX_API void* SLX_CALLCONV SLX_CreateRenderTarget(void* tex_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(tex_handle != nullptr);
+
+    error_code error_code = error_code::ok;
+
+    unsigned int fbo;
+    glGenFramebuffers(1, &fbo);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, unpack(tex_handle), 0);
+
+    SLX_FAIL_ON_GL_ERROR_GOTO(failed);
+    glBindFramebuffer(GL_FRAMEBUFFER, current_context->current_fbo);
+
+    if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE)
+    {
+        error_code = error_code::gl_framebuffer_not_complete;
+        goto failed;
+    }
+
+    return pack(fbo);
+failed:
+    if (fbo)
+        glDeleteFramebuffers(1, &fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, current_context->current_fbo);
+    return nullptr;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_SetRenderTarget(void* fbo_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(fbo_handle != nullptr);
+
+    SLX_FAIL_COND(current_context->recording_bundle != nullptr, error_code::bundle_recording);
+
+    GLuint fbo = unpack(fbo_handle);
+    if (current_context->current_fbo != fbo)
+    {
+        // no need to check wheather it's equals to 0
+        glBindFramebuffer(GL_FRAMEBUFFER, fbo);
+        SLX_FAIL_ON_GL_ERROR();
+        current_context->current_fbo = fbo;
+        count_bind_issued(&frame_stats::fbo_binds);
+    }
+    else
+        count_bind_skipped(&frame_stats::fbo_binds);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_DeleteRenderTarget(void* fbo_handle)
+{
+    SLX_TIMED_CALL();
+
+    assert(fbo_handle != nullptr);
+
+    GLuint fbo = unpack(fbo_handle);
+    assert(fbo != 0);
+    glDeleteFramebuffers(1, &fbo);
+    SLX_FAIL_ON_GL_ERROR();
+    return false;
 }
\ No newline at end of file
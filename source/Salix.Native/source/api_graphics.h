@@ -1,87 +1,557 @@
-#pragma once
-#ifndef H_API_GRAPHICS
-#define H_API_GRAPHICS
-
-#include <glad/glad.h>
-#undef APIENTRY
-#include <cstdint>
-#include "common.h"
-#include "error.h"
-#include "graphics_enums.h"
-
-struct vertex_type_handle
-{
-    VertexElementType* type_ptr;
-    int length;
-    // for the default 'DrawPrimitive' method 
-    // TODO: did we really need that?
-    GLuint default_vao;
-};
-
-struct buffer_handle
-{
-    GLuint vbo, vao, ibo;
-};
-
-typedef struct HGLRC__* HGLRC;
-
-struct opengl_render_context
-{
-    HGLRC hglrc;
-
-    GLuint current_vbo;
-    GLuint current_vao;
-    GLuint current_texture;
-    GLuint current_shader;
-    GLuint current_fbo;
-
-    GLuint default_vbo;
-
-    GLuint expected_texture;
-    GLuint expected_shader;
-    GLuint expected_fbo;
-};
-
-extern opengl_render_context* current_context;
-
-struct render_context_info
-{
-    int32_t max_textures;
-};
-
-void graphics_initialize();
-
-SLX_API s_bool SLX_CALLCONV SLX_QueryRenderContextInfo(P_OUT render_context_info* out_render_context_info);
-SLX_API s_bool SLX_CALLCONV SLX_Viewport(int32_t x, int32_t y, int32_t width, int32_t height);
-SLX_API s_bool SLX_CALLCONV SLX_Clear(float r, float g, float b, float a);
-SLX_API void* SLX_CALLCONV SLX_RegisterVertexType(P_IN VertexElementType* type, int32_t len);
-SLX_API buffer_handle* SLX_CALLCONV SLX_CreateVertexBuffer(P_IN vertex_type_handle* vertex_type, s_bool use_ibo);
-SLX_API s_bool SLX_CALLCONV SLX_DeleteVertexBuffer(P_IN buffer_handle* buffer);
-SLX_API s_bool SLX_CALLCONV SLX_DrawPrimitives(P_IN vertex_type_handle* vertex_type, PrimitiveType pt, void* data, int32_t data_size, int32_t vertices_to_draw);
-SLX_API s_bool SLX_CALLCONV SLX_SetVertexBufferData(buffer_handle* buffer_handle, void* data, int32_t dataSize, VertexBufferDataUsage data_usage);
-SLX_API s_bool SLX_CALLCONV SLX_DrawBufferPrimitives(buffer_handle* buffer_handle, PrimitiveType primitiveType, int32_t verticesCount);
-SLX_API s_bool SLX_CALLCONV SLX_SetIndexBufferData(buffer_handle* buffer_handle, void* data, int32_t dataSize, VertexBufferDataUsage data_usage);
-SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedBufferPrimitives(buffer_handle* buffer_handle, PrimitiveType primitiveType, int32_t verticesCount);
-SLX_API void* SLX_CALLCONV SLX_CreateTexture(int32_t width, int32_t height);
-SLX_API s_bool SLX_CALLCONV SLX_SetTextureFilter(void* tex_handle, TextureFilterType min, TextureFilterType max);
-SLX_API s_bool SLX_CALLCONV SLX_SetTextureWrap(void* tex_handle, TextureWrapType wrap);
-SLX_API s_bool SLX_CALLCONV SLX_SetTextureData(void* tex_handle, int32_t width, int32_t height, void* data, ImageFormat imageFormat);
-SLX_API s_bool SLX_CALLCONV SLX_DeleteTexture(void* tex_handle);
-SLX_API s_bool SLX_CALLCONV SLX_SetTexture(int32_t index, void* tex_handle);
-SLX_API void* SLX_CALLCONV SLX_CreateShaderFromGlsl(const char* vert_source, const char* frag_source);
-SLX_API s_bool SLX_CALLCONV SLX_DeleteShader(void* shader_handle);
-SLX_API s_bool SLX_CALLCONV SLX_SetShader(void* shader_handle);
-SLX_API void* SLX_CALLCONV SLX_CreateSampler(TextureFilterType filter_type, TextureWrapType wrap_type);
-SLX_API s_bool SLX_CALLCONV SLX_DeleteSampler(void* sampler_handle);
-SLX_API s_bool SLX_CALLCONV SLX_SetSampler(int32_t index, void* sampler_handle);
-SLX_API int SLX_CALLCONV SLX_GetShaderParamLocation(void* shader_handle, const char* name_utf8);
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamInt(void* shader_handle, int32_t loc, int32_t value);
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamFloat(void* shader_handle, int32_t loc, float value);
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamVec4(void* shader_handle, int32_t loc, P_IN float* vec);
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat4(void* shader_handle, int32_t loc, P_IN float* mat);
-SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat3x2(void* shader_handle, int32_t loc, P_IN float* mat);
-SLX_API void* SLX_CALLCONV SLX_CreateRenderTarget(void* tex_handle);
-SLX_API s_bool SLX_CALLCONV SLX_DeleteRenderTarget(void* fbo_handle);
-SLX_API s_bool SLX_CALLCONV SLX_SetRenderTarget(void* fbo_handle);
-
+#pragma once
+#ifndef H_API_GRAPHICS
+#define H_API_GRAPHICS
+
+#include <glad/glad.h>
+#undef APIENTRY
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+#include "common.h"
+#include "error.h"
+#include "graphics_enums.h"
+
+struct vertex_type_handle
+{
+    VertexElementType* type_ptr;
+    int length;
+    int stride;
+    // the last 'instance_length' elements advance per instance, with their own stride
+    int instance_length;
+    int instance_stride;
+    // for drawing from the streaming buffer, rebuilt when the buffer is reallocated
+    GLuint stream_vao;
+    uint32_t stream_generation;
+};
+
+struct buffer_handle
+{
+    GLuint vbo, vao, ibo;
+    // holds the per-instance attributes, 0 if the vertex type has none
+    GLuint instance_vbo;
+    // GL_UNSIGNED_BYTE/SHORT/INT, set by the last SLX_SetIndexBufferData
+    GLenum index_type;
+    // sizes of the stores in bytes, the *SubData calls are checked against them
+    int32_t vertex_bytes;
+    int32_t index_bytes;
+};
+
+// ../Salix/Graphics/Vertex/IndexedDrawRange.cs
+struct indexed_draw_range
+{
+    int32_t first_index;
+    int32_t count;
+    // added to every index before fetching the vertex
+    int32_t base_vertex;
+};
+
+// ../Salix/Graphics/ShaderParameterBlock.cs ShaderParamType
+enum class uniform_type : int32_t
+{
+    int1,
+    float1,
+    vec4,
+    mat4,
+    mat3x2
+};
+
+// last value uploaded to a uniform location, ints are stored by their bits
+struct uniform_slot
+{
+    s_bool known;
+    uniform_type type;
+    float values[16];
+    // from the reflection, uploads of another type are rejected. 0 if the location wasn't reflected
+    GLenum declared_type;
+};
+
+// ../Salix/Platform/Interop.cs ShaderUniformInfo
+struct shader_uniform_info
+{
+    char name[128];
+    // as returned by glGetActiveUniform, like GL_FLOAT_VEC4
+    GLenum type;
+    // the array length, 1 if it isn't an array
+    int32_t size;
+    // -1 for members of a uniform block
+    int32_t location;
+    // index into the block table of the program, -1 for plain uniforms
+    int32_t block;
+    // in bytes from the start of the block, -1 for plain uniforms
+    int32_t offset;
+};
+
+// ../Salix/Platform/Interop.cs ShaderUniformBlockInfo
+struct shader_uniform_block_info
+{
+    char name[128];
+    int32_t binding;
+    int32_t data_size;
+};
+
+struct shader_handle
+{
+    GLuint program;
+    // indexed by location, see set_uniform in api_graphics.cpp
+    std::vector<uniform_slot> uniforms;
+    // the stages of a link not checked yet, both 0 once shader_finish ran
+    GLuint vert, frag;
+    // the link result is saved to the program cache under 'cache_key' when it succeeds
+    s_bool cache_store;
+    uint64_t cache_key;
+    // what shader_finish found, returned again by every later use of a failed shader
+    error_code status;
+    // the compile and link output of every stage, available once finished
+    std::string log;
+    // every active uniform and uniform block, filled once the program is linked
+    std::vector<shader_uniform_info> uniform_table;
+    std::vector<shader_uniform_block_info> block_table;
+};
+
+// one entry of SLX_SetShaderParams, followed by the values of the type
+struct shader_param_entry
+{
+    int32_t location;
+    uniform_type type;
+};
+
+struct uniform_buffer_handle
+{
+    GLuint ubo;
+    int32_t size;
+};
+
+// ../Salix/Platform/Interop.cs AtlasRegion
+struct atlas_region
+{
+    void* tex_handle;
+    int32_t x, y;
+    float u0, v0, u1, v1;
+};
+
+// top edge of the packed area from 'x' to 'x + width'
+struct skyline_node
+{
+    int32_t x, y, width;
+};
+
+struct atlas_page
+{
+    GLuint tex;
+    std::vector<skyline_node> skyline;
+};
+
+// see the texture atlas region in api_graphics.cpp
+struct texture_atlas_handle
+{
+    int32_t page_size;
+    // pages have no mip levels, so the mipmap filters are rejected
+    GLenum min_filter, mag_filter;
+    std::vector<atlas_page> pages;
+};
+
+// recorded by SLX_BeginBundle/SLX_EndBundle, see the bundle region in api_graphics.cpp
+struct bundle_handle
+{
+    // packed as an op byte followed by its payload
+    std::vector<s_byte> commands;
+};
+
+// ../Salix/Platform/Interop.cs SpriteDesc
+struct sprite_desc
+{
+    void* tex_handle;
+    float x, y;
+    float origin_x, origin_y;
+    float scale_x, scale_y;
+    float radians;
+    float width, height;
+    float u0, v0, u1, v1;
+    float r, g, b, a;
+};
+
+// per-instance record of the instanced sprite path, the quad is expanded in the vertex shader
+// ../Salix/Embedded/SpriteShaderInstanced.vert
+struct sprite_instance
+{
+    float x, y;
+    float origin_x, origin_y;
+    // already multiplied by the scale
+    float width, height;
+    float radians;
+    float u0, v0, u1, v1;
+    uint8_t r, g, b, a;
+};
+
+// same layout as VertexPosition2DColorTexture
+struct sprite_vertex
+{
+    float x, y;
+    float r, g, b, a;
+    float u, v;
+};
+
+// number of frames the streaming buffer is split into
+constexpr int32_t stream_regions = 3;
+
+// per-frame ring buffer for transient vertices,
+// persistently mapped when ARB_buffer_storage is present
+struct stream_buffer
+{
+    GLuint vbo;
+    int32_t region_size;
+    int32_t region;
+    int32_t head;
+    GLsync fences[stream_regions];
+    s_byte* persistent;
+    s_bool mapped;
+    uint32_t generation;
+};
+
+// a texture upload the gpu may still be reading out of the upload ring
+struct pending_upload
+{
+    int64_t token;
+    int32_t offset;
+    int32_t size;
+    GLsync fence;
+};
+
+// pixel unpack buffer the async texture uploads are staged in,
+// ranges are handed out in order and retired oldest first as their fences signal
+struct upload_ring
+{
+    GLuint pbo;
+    int32_t size;
+    int32_t head;
+    int64_t last_token;
+    std::deque<pending_upload> pending;
+};
+
+// frames a gpu profiler frame waits before its queries are read, so the reads don't stall
+constexpr int32_t gpu_profiler_latency = 4;
+// scopes past this in one frame are not timed
+constexpr int32_t max_gpu_scopes = 256;
+
+// ../Salix/Platform/Interop.cs GpuScopeResult
+struct gpu_scope_result
+{
+    int32_t name;
+    int32_t depth;
+    // nanoseconds from the start of the frame
+    int64_t begin;
+    int64_t duration;
+};
+
+// ../Salix/Platform/Interop.cs GpuFrameInfo
+struct gpu_frame_info
+{
+    // -1 until a frame has been read back
+    int64_t frame;
+    // nanoseconds between the frame's first and last gpu command
+    int64_t duration;
+    int32_t scope_count;
+    // frames whose queries were still not available when their slot came around again
+    int32_t dropped_frames;
+};
+
+struct gpu_profiler_frame
+{
+    // timestamp queries, the frame start and end first, then a begin and an end per scope
+    std::vector<GLuint> queries;
+    std::vector<gpu_scope_result> scopes;
+    int64_t frame;
+    s_bool pending;
+};
+
+struct gpu_profiler
+{
+    s_bool enabled;
+    int32_t current;
+    int64_t frame;
+    gpu_profiler_frame frames[gpu_profiler_latency];
+    // scope indices of the current frame not ended yet
+    std::vector<int32_t> open_scopes;
+    gpu_frame_info result_info;
+    std::vector<gpu_scope_result> results;
+};
+
+typedef struct HGLRC__* HGLRC;
+
+// texture units shadowed by the state cache, more than any sprite or shader here uses
+constexpr int32_t max_texture_units = 16;
+// uniform block binding points handed out by name, gl 3.3 guarantees 36 per program
+constexpr int32_t max_uniform_bindings = 24;
+// for shadowed bindings whose real value is not known, never equals a gl name
+constexpr GLuint unknown_binding = ~0u;
+
+// ../Salix/Platform/Interop.cs BindStats
+struct bind_stats
+{
+    // gl state calls made
+    int64_t issued;
+    // gl state calls avoided as the shadow already matched
+    int64_t skipped;
+};
+
+// ../Salix/Graphics/GLErrorPolicy.cs
+enum class gl_error_policy : int32_t
+{
+    // glGetError after every gl call, the failing SLX call returns the error
+    per_call,
+    // glGetError once a frame, after a failed frame the next one is polled per call to find the site
+    per_frame,
+    // no polling, errors come from the ARB_debug_output callback
+    debug_callback
+};
+
+// ../Salix/Platform/Interop.cs GLErrorReport
+struct gl_error_report
+{
+    error_code code;
+    int32_t line;
+    // the first failing call site, null if it was not found
+    const char* function;
+    // the debug output message, empty for the polling policies
+    char message[256];
+};
+
+// ../Salix/Platform/Interop.cs UniformStats
+struct uniform_stats
+{
+    int64_t uploaded;
+    // identical to the value the program already holds
+    int64_t skipped;
+};
+
+// ../Salix/Platform/Interop.cs ProgramCacheStats
+struct program_cache_stats
+{
+    // programs loaded from a cached binary
+    int64_t hits;
+    // programs compiled from source while the cache was enabled, stale or rejected entries included
+    int64_t misses;
+};
+
+struct program_cache
+{
+    // empty while disabled
+    std::wstring directory;
+    // of the vendor, renderer and version strings, so a driver update invalidates every entry
+    uint64_t driver_hash;
+    program_cache_stats stats;
+};
+
+// ../Salix/Platform/Interop.cs FrameStats
+struct frame_stats
+{
+    int64_t draws;
+    // of non-indexed draws, both multiplied by the instance count
+    int64_t vertices;
+    int64_t indices;
+    // copied into buffers, streamed vertices included
+    int64_t buffer_bytes;
+    int64_t texture_bytes;
+    bind_stats texture_binds;
+    bind_stats shader_binds;
+    bind_stats vao_binds;
+    bind_stats fbo_binds;
+    // buffers, samplers, blend state and viewport
+    bind_stats other_binds;
+    uniform_stats uniforms;
+    // glGetError calls
+    int64_t gl_error_checks;
+    int64_t api_calls;
+    // wall time inside the SLX calls, a nested call counts as part of its caller
+    int64_t api_nanoseconds;
+};
+
+struct opengl_render_context
+{
+    HGLRC hglrc;
+
+    gl_error_policy error_policy;
+    // whether SLX_FAIL_ON_GL_ERROR polls, see gl_error_policy
+    s_bool check_gl_errors;
+    // the per-frame policy is polling per call this frame to locate 'pending_gl_error'
+    s_bool locating_gl_error;
+    error_code pending_gl_error;
+    // kept until SLX_GetGLErrorReport, code is ok when there is nothing to report
+    gl_error_report gl_error;
+
+    // shadow of the gl state, every ensure_* compares against it first
+    GLuint current_vbo;
+    GLuint current_vao;
+    // the element binding belongs to the vao, so it's unknown after switching vaos
+    GLuint current_ibo;
+    GLuint active_unit;
+    GLuint current_textures[max_texture_units];
+    // GL_TEXTURE_2D_ARRAY is a separate target, each unit holds one of both
+    GLuint current_texture_arrays[max_texture_units];
+    GLuint current_samplers[max_texture_units];
+    GLuint current_shader;
+    GLuint current_fbo;
+    // generic GL_UNIFORM_BUFFER binding, also moved by glBindBufferBase
+    GLuint current_ubo;
+    GLuint current_uniform_buffers[max_uniform_bindings];
+    s_bool blend_enabled;
+    GLenum blend_src, blend_dst;
+    int32_t viewport[4];
+    // totals since the context was created
+    bind_stats stats;
+    uniform_stats uniform_uploads;
+    // since the last SLX_GetFrameStats that reset it
+    frame_stats frame;
+    int32_t api_call_depth;
+
+    stream_buffer stream;
+    upload_ring uploads;
+    gpu_profiler profiler;
+    program_cache programs;
+
+    GLuint sprite_vao;
+    GLuint sprite_ibo;
+    uint32_t sprite_vao_generation;
+    GLuint sprite_quad_vbo;
+    GLuint sprite_instance_vao;
+
+    // a block name's binding point is its index, shared by every program declaring the block
+    std::vector<std::string> uniform_block_names;
+
+    // scratch arrays of SLX_MultiDrawIndexed, kept to not allocate per call
+    std::vector<GLsizei> multi_draw_counts;
+    std::vector<const void*> multi_draw_offsets;
+    std::vector<GLint> multi_draw_base_vertices;
+
+    // not null between SLX_BeginBundle and SLX_EndBundle
+    bundle_handle* recording_bundle;
+
+    // applied lazily by the draws, only units below 'expected_units' are looked at
+    GLuint expected_textures[max_texture_units];
+    GLuint expected_texture_arrays[max_texture_units];
+    GLuint expected_units;
+    GLuint expected_shader;
+    GLuint expected_fbo;
+};
+
+extern opengl_render_context* current_context;
+
+// adds the call it's declared in to the frame stats, calls made from inside one are not counted again
+struct api_call_timer
+{
+    std::chrono::steady_clock::time_point start;
+
+    api_call_timer()
+    {
+        if (current_context->api_call_depth++ == 0)
+            start = std::chrono::steady_clock::now();
+    }
+
+    ~api_call_timer()
+    {
+        if (--current_context->api_call_depth != 0)
+            return;
+        frame_stats& frame = current_context->frame;
+        frame.api_calls++;
+        frame.api_nanoseconds += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count();
+    }
+};
+
+#define SLX_TIMED_CALL() api_call_timer slx_call_timer
+
+struct render_context_info
+{
+    int32_t max_textures;
+};
+
+void graphics_initialize(gl_error_policy error_policy);
+void graphics_end_frame();
+
+SLX_API s_bool SLX_CALLCONV SLX_QueryRenderContextInfo(P_OUT render_context_info* out_render_context_info);
+SLX_API s_bool SLX_CALLCONV SLX_GetGLErrorReport(P_OUT gl_error_report* out_report);
+SLX_API s_bool SLX_CALLCONV SLX_QueryBindStats(P_OUT bind_stats* out_stats);
+SLX_API s_bool SLX_CALLCONV SLX_QueryUniformStats(P_OUT uniform_stats* out_stats);
+SLX_API s_bool SLX_CALLCONV SLX_GetFrameStats(P_OUT frame_stats* out_stats, s_bool reset);
+SLX_API s_bool SLX_CALLCONV SLX_Viewport(int32_t x, int32_t y, int32_t width, int32_t height);
+SLX_API s_bool SLX_CALLCONV SLX_Clear(float r, float g, float b, float a);
+SLX_API void* SLX_CALLCONV SLX_RegisterVertexType(P_IN VertexElementType* type, int32_t len, int32_t instance_len);
+SLX_API buffer_handle* SLX_CALLCONV SLX_CreateVertexBuffer(P_IN vertex_type_handle* vertex_type, s_bool use_ibo);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteVertexBuffer(P_IN buffer_handle* buffer);
+SLX_API s_bool SLX_CALLCONV SLX_DrawPrimitives(P_IN vertex_type_handle* vertex_type, PrimitiveType pt, void* data, int32_t data_size, int32_t vertices_to_draw);
+SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedPrimitives(P_IN vertex_type_handle* vertex_type, PrimitiveType pt, P_IN void* vertices, int32_t vertices_size, P_IN void* indices, int32_t indices_size, IndexType index_type);
+SLX_API s_bool SLX_CALLCONV SLX_SetVertexBufferData(buffer_handle* buffer_handle, void* data, int32_t dataSize, VertexBufferDataUsage data_usage);
+SLX_API s_bool SLX_CALLCONV SLX_AllocateVertexBuffer(buffer_handle* buffer_handle, int32_t dataSize, VertexBufferDataUsage data_usage);
+SLX_API s_bool SLX_CALLCONV SLX_SetVertexBufferSubData(buffer_handle* buffer_handle, int32_t offset, P_IN void* data, int32_t dataSize);
+SLX_API s_bool SLX_CALLCONV SLX_DrawBufferPrimitives(buffer_handle* buffer_handle, PrimitiveType primitiveType, int32_t first, int32_t verticesCount);
+SLX_API s_bool SLX_CALLCONV SLX_SetIndexBufferData(buffer_handle* buffer_handle, void* data, int32_t dataSize, VertexBufferDataUsage data_usage, IndexType index_type);
+SLX_API s_bool SLX_CALLCONV SLX_AllocateIndexBuffer(buffer_handle* buffer_handle, int32_t dataSize, VertexBufferDataUsage data_usage, IndexType index_type);
+SLX_API s_bool SLX_CALLCONV SLX_SetIndexBufferSubData(buffer_handle* buffer_handle, int32_t offset, P_IN void* data, int32_t dataSize);
+SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedBufferPrimitives(buffer_handle* buffer_handle, PrimitiveType primitiveType, int32_t first_index, int32_t indicesCount, int32_t base_vertex);
+SLX_API s_bool SLX_CALLCONV SLX_SetInstanceBufferData(buffer_handle* buffer_handle, void* data, int32_t dataSize, VertexBufferDataUsage data_usage);
+SLX_API s_bool SLX_CALLCONV SLX_DrawInstanced(buffer_handle* buffer_handle, PrimitiveType primitiveType, int32_t first, int32_t verticesCount, int32_t instanceCount);
+SLX_API s_bool SLX_CALLCONV SLX_DrawIndexedInstanced(buffer_handle* buffer_handle, PrimitiveType primitiveType, int32_t first_index, int32_t indicesCount, int32_t base_vertex, int32_t instanceCount);
+SLX_API s_bool SLX_CALLCONV SLX_MultiDrawIndexed(buffer_handle* buffer_handle, PrimitiveType primitiveType, P_IN indexed_draw_range* ranges, int32_t count);
+SLX_API s_bool SLX_CALLCONV SLX_SubmitSprites(P_IN sprite_desc* sprites, int32_t count, P_OUT int32_t* out_draw_calls);
+SLX_API s_bool SLX_CALLCONV SLX_SubmitSpriteInstances(P_IN sprite_desc* sprites, int32_t count, P_OUT int32_t* out_draw_calls);
+SLX_API s_bool SLX_CALLCONV SLX_SetGpuProfiling(s_bool enabled);
+SLX_API s_bool SLX_CALLCONV SLX_GpuScopeBegin(int32_t name);
+SLX_API s_bool SLX_CALLCONV SLX_GpuScopeEnd();
+SLX_API s_bool SLX_CALLCONV SLX_GetGpuFrameResults(P_OUT gpu_frame_info* out_info, P_OUT gpu_scope_result* out_scopes, int32_t capacity);
+SLX_API void* SLX_CALLCONV SLX_MapStreamBuffer(int32_t size, int32_t stride, P_OUT int32_t* out_offset);
+SLX_API s_bool SLX_CALLCONV SLX_DrawStreamPrimitives(P_IN vertex_type_handle* vertex_type, PrimitiveType pt, int32_t offset, int32_t vertices_to_draw);
+SLX_API void* SLX_CALLCONV SLX_CreateTexture(int32_t width, int32_t height);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureFilter(void* tex_handle, TextureFilterType min, TextureFilterType max);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureWrap(void* tex_handle, TextureWrapType wrap);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureData(void* tex_handle, int32_t width, int32_t height, void* data, ImageFormat imageFormat);
+SLX_API int64_t SLX_CALLCONV SLX_SetTextureDataAsync(void* tex_handle, int32_t width, int32_t height, P_IN void* data, ImageFormat imageFormat);
+SLX_API s_bool SLX_CALLCONV SLX_IsUploadComplete(int64_t token, P_OUT s_bool* out_complete);
+SLX_API s_bool SLX_CALLCONV SLX_IsImageFormatSupported(ImageFormat imageFormat, P_OUT s_bool* out_supported);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureSubData(void* tex_handle, int32_t x, int32_t y, int32_t width, int32_t height, P_IN void* data, int32_t stride, ImageFormat imageFormat);
+SLX_API s_bool SLX_CALLCONV SLX_AllocateTexture(void* tex_handle, int32_t width, int32_t height, int32_t mip_levels, ImageFormat imageFormat);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureLevelData(void* tex_handle, int32_t level, int32_t width, int32_t height, P_IN void* data, ImageFormat imageFormat);
+SLX_API s_bool SLX_CALLCONV SLX_GenerateMipmaps(void* tex_handle);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteTexture(void* tex_handle);
+SLX_API s_bool SLX_CALLCONV SLX_SetTexture(int32_t index, void* tex_handle);
+SLX_API void* SLX_CALLCONV SLX_CreateTextureArray(int32_t width, int32_t height, int32_t layers, ImageFormat imageFormat, TextureFilterType filter_type, TextureWrapType wrap_type);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureArrayLayer(void* tex_handle, int32_t layer, int32_t width, int32_t height, void* data, ImageFormat imageFormat);
+SLX_API s_bool SLX_CALLCONV SLX_SetTextureArray(int32_t index, void* tex_handle);
+SLX_API shader_handle* SLX_CALLCONV SLX_CreateShaderAsync(const char* vert_source, const char* frag_source);
+SLX_API s_bool SLX_CALLCONV SLX_IsShaderReady(P_IN shader_handle* shader, P_OUT s_bool* out_ready);
+SLX_API s_bool SLX_CALLCONV SLX_WaitShader(P_IN shader_handle* shader);
+SLX_API int32_t SLX_CALLCONV SLX_GetShaderLog(P_IN shader_handle* shader, P_OUT char* out_log, int32_t capacity);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderCompilerThreads(int32_t count, P_OUT s_bool* out_supported);
+SLX_API s_bool SLX_CALLCONV SLX_SetProgramCacheDirectory(P_IN wchar_t* directory, P_OUT s_bool* out_enabled);
+SLX_API s_bool SLX_CALLCONV SLX_GetProgramCacheStats(P_OUT program_cache_stats* out_stats);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteShader(P_IN shader_handle* shader);
+SLX_API s_bool SLX_CALLCONV SLX_SetShader(P_IN shader_handle* shader);
+SLX_API void* SLX_CALLCONV SLX_CreateSampler(TextureFilterType filter_type, TextureWrapType wrap_type);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteSampler(void* sampler_handle);
+SLX_API s_bool SLX_CALLCONV SLX_SetSampler(int32_t index, void* sampler_handle);
+SLX_API int32_t SLX_CALLCONV SLX_GetShaderUniforms(P_IN shader_handle* shader, P_OUT shader_uniform_info* out_uniforms, int32_t capacity);
+SLX_API int32_t SLX_CALLCONV SLX_GetShaderUniformBlocks(P_IN shader_handle* shader, P_OUT shader_uniform_block_info* out_blocks, int32_t capacity);
+SLX_API int SLX_CALLCONV SLX_GetShaderParamLocation(P_IN shader_handle* shader, const char* name_utf8);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamInt(P_IN shader_handle* shader, int32_t loc, int32_t value);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamFloat(P_IN shader_handle* shader, int32_t loc, float value);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamVec4(P_IN shader_handle* shader, int32_t loc, P_IN float* vec);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat4(P_IN shader_handle* shader, int32_t loc, P_IN float* mat);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParamMat3x2(P_IN shader_handle* shader, int32_t loc, P_IN float* mat);
+SLX_API s_bool SLX_CALLCONV SLX_SetShaderParams(P_IN shader_handle* shader, P_IN void* data, int32_t size);
+SLX_API texture_atlas_handle* SLX_CALLCONV SLX_CreateTextureAtlas(int32_t page_size, TextureFilterType filter_type);
+SLX_API s_bool SLX_CALLCONV SLX_AddAtlasImage(P_IN texture_atlas_handle* atlas, int32_t width, int32_t height, P_IN void* data, ImageFormat imageFormat, P_OUT atlas_region* out_region);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteTextureAtlas(P_IN texture_atlas_handle* atlas);
+SLX_API uniform_buffer_handle* SLX_CALLCONV SLX_CreateUniformBuffer(int32_t size, VertexBufferDataUsage data_usage);
+SLX_API s_bool SLX_CALLCONV SLX_SetUniformBufferData(P_IN uniform_buffer_handle* buffer, int32_t offset, P_IN void* data, int32_t size);
+SLX_API s_bool SLX_CALLCONV SLX_BindUniformBuffer(int32_t binding, P_IN uniform_buffer_handle* buffer);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteUniformBuffer(P_IN uniform_buffer_handle* buffer);
+SLX_API int32_t SLX_CALLCONV SLX_GetUniformBlockBinding(const char* name_utf8);
+SLX_API void* SLX_CALLCONV SLX_CreateRenderTarget(void* tex_handle);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteRenderTarget(void* fbo_handle);
+SLX_API s_bool SLX_CALLCONV SLX_SetRenderTarget(void* fbo_handle);
+SLX_API s_bool SLX_CALLCONV SLX_BeginBundle();
+SLX_API bundle_handle* SLX_CALLCONV SLX_EndBundle();
+SLX_API s_bool SLX_CALLCONV SLX_ExecuteBundle(P_IN bundle_handle* bundle);
+SLX_API s_bool SLX_CALLCONV SLX_DeleteBundle(P_IN bundle_handle* bundle);
+
 #endif
\ No newline at end of file
@@ -1,38 +1,234 @@
-#include "api_resource.h"
-#include <stb_image.h>
-
-// just temporarily use stb_image
-// you can always switch to other libraries you like easily here
-static void* load_image(void* mem, int length, P_OUT int* x, P_OUT int* y, P_OUT int* data_length, P_OUT ImageFormat* format)
-{
-    int channels;
-    s_byte* data = stbi_load_from_memory((stbi_uc*)mem, length, x, y, &channels, 0);
-    switch (channels)
-    {
-    case 1: *format = ImageFormat::R8; break;
-    case 2: *format = ImageFormat::Rg16; break;
-    case 3: *format = ImageFormat::Rgb24; break;
-    case 4: *format = ImageFormat::Rgba32; break;
-    default:
-        *format = (ImageFormat)-1;
-        stbi_image_free(data);
-        return nullptr;
-    }
-    *data_length = *x * *y * channels;
-    return data;
-}
-
-static void free_image(void* data)
-{
-    stbi_image_free(data);
-}
-
-SLX_API void* SLX_CALLCONV SLX_LoadImage(void* mem, int length, P_OUT int* x, P_OUT int* y, P_OUT int* data_length, P_OUT ImageFormat* format)
-{
-    return load_image(mem, length, x, y, data_length, format);
-}
-
-SLX_API void SLX_CALLCONV SLX_FreeImage(void* texData)
-{
-    free_image(texData);
-}
\ No newline at end of file
+#include "api_resource.h"
+#include <cstring>
+#include <stb_image.h>
+#include "error.h"
+
+// just temporarily use stb_image
+// you can always switch to other libraries you like easily here
+static void* load_image(void* mem, int length, P_OUT int* x, P_OUT int* y, P_OUT int* data_length, P_OUT ImageFormat* format)
+{
+    int channels;
+    s_byte* data = stbi_load_from_memory((stbi_uc*)mem, length, x, y, &channels, 0);
+    switch (channels)
+    {
+    case 1: *format = ImageFormat::R8; break;
+    case 2: *format = ImageFormat::Rg16; break;
+    case 3: *format = ImageFormat::Rgb24; break;
+    case 4: *format = ImageFormat::Rgba32; break;
+    default:
+        *format = (ImageFormat)-1;
+        stbi_image_free(data);
+        return nullptr;
+    }
+    *data_length = *x * *y * channels;
+    return data;
+}
+
+static void free_image(void* data)
+{
+    stbi_image_free(data);
+}
+
+SLX_API void* SLX_CALLCONV SLX_LoadImage(void* mem, int length, P_OUT int* x, P_OUT int* y, P_OUT int* data_length, P_OUT ImageFormat* format)
+{
+    return load_image(mem, length, x, y, data_length, format);
+}
+
+SLX_API void SLX_CALLCONV SLX_FreeImage(void* texData)
+{
+    free_image(texData);
+}
+
+#pragma region image container
+
+// pre-compressed textures are not decoded, their levels are located in the file and uploaded as they are
+
+static const s_byte ktx2_identifier[12] = { 0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB, '\r', '\n', 0x1A, '\n' };
+static const s_byte dds_magic[4] = { 'D', 'D', 'S', ' ' };
+
+static uint32_t read_u32(const s_byte* p)
+{
+    uint32_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint64_t read_u64(const s_byte* p)
+{
+    uint64_t value;
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static constexpr uint32_t fourcc(char a, char b, char c, char d)
+{
+    return (uint32_t)(s_byte)a | (uint32_t)(s_byte)b << 8 | (uint32_t)(s_byte)c << 16 | (uint32_t)(s_byte)d << 24;
+}
+
+// the srgb variants are left out, the formats here are all sampled as linear
+static ImageFormat vk_format_to_image_format(uint32_t vk_format)
+{
+    switch (vk_format)
+    {
+    case 9: return ImageFormat::R8;       // VK_FORMAT_R8_UNORM
+    case 16: return ImageFormat::Rg16;    // VK_FORMAT_R8G8_UNORM
+    case 23: return ImageFormat::Rgb24;   // VK_FORMAT_R8G8B8_UNORM
+    case 37: return ImageFormat::Rgba32;  // VK_FORMAT_R8G8B8A8_UNORM
+    case 131:                             // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    case 133: return ImageFormat::Bc1;    // VK_FORMAT_BC1_RGBA_UNORM_BLOCK
+    case 137: return ImageFormat::Bc3;    // VK_FORMAT_BC3_UNORM_BLOCK
+    case 139: return ImageFormat::Bc4;    // VK_FORMAT_BC4_UNORM_BLOCK
+    case 141: return ImageFormat::Bc5;    // VK_FORMAT_BC5_UNORM_BLOCK
+    case 145: return ImageFormat::Bc7;    // VK_FORMAT_BC7_UNORM_BLOCK
+    }
+    return (ImageFormat)-1;
+}
+
+static ImageFormat dxgi_format_to_image_format(uint32_t dxgi_format)
+{
+    switch (dxgi_format)
+    {
+    case 28: return ImageFormat::Rgba32;  // DXGI_FORMAT_R8G8B8A8_UNORM
+    case 49: return ImageFormat::Rg16;    // DXGI_FORMAT_R8G8_UNORM
+    case 61: return ImageFormat::R8;      // DXGI_FORMAT_R8_UNORM
+    case 70:                              // DXGI_FORMAT_BC1_TYPELESS
+    case 71: return ImageFormat::Bc1;     // DXGI_FORMAT_BC1_UNORM
+    case 76:                              // DXGI_FORMAT_BC3_TYPELESS
+    case 77: return ImageFormat::Bc3;     // DXGI_FORMAT_BC3_UNORM
+    case 79:                              // DXGI_FORMAT_BC4_TYPELESS
+    case 80: return ImageFormat::Bc4;     // DXGI_FORMAT_BC4_UNORM
+    case 82:                              // DXGI_FORMAT_BC5_TYPELESS
+    case 83: return ImageFormat::Bc5;     // DXGI_FORMAT_BC5_UNORM
+    case 97:                              // DXGI_FORMAT_BC7_TYPELESS
+    case 98: return ImageFormat::Bc7;     // DXGI_FORMAT_BC7_UNORM
+    }
+    return (ImageFormat)-1;
+}
+
+static ImageFormat dds_fourcc_to_image_format(uint32_t code)
+{
+    switch (code)
+    {
+    case fourcc('D', 'X', 'T', '1'): return ImageFormat::Bc1;
+    case fourcc('D', 'X', 'T', '5'): return ImageFormat::Bc3;
+    case fourcc('A', 'T', 'I', '1'):
+    case fourcc('B', 'C', '4', 'U'): return ImageFormat::Bc4;
+    case fourcc('A', 'T', 'I', '2'):
+    case fourcc('B', 'C', '5', 'U'): return ImageFormat::Bc5;
+    }
+    return (ImageFormat)-1;
+}
+
+static s_bool set_container_level(image_container* out, int32_t level, uint64_t offset, uint64_t size, int32_t length)
+{
+    int32_t w = out->width >> level, h = out->height >> level;
+    int64_t expected = ImageFormat_get_data_size(out->format, w ? w : 1, h ? h : 1);
+    SLX_FAIL_COND(size < (uint64_t)expected || offset > (uint64_t)length || size > (uint64_t)length - offset, error_code::image_container_invalid);
+    out->level_offsets[level] = (int32_t)offset;
+    out->level_sizes[level] = (int32_t)expected;
+    return false;
+}
+
+// https://registry.khronos.org/KTX/specs/2.0/ktxspec.v2.html
+static s_bool parse_ktx2(const s_byte* mem, int32_t length, image_container* out)
+{
+    constexpr int32_t header_size = 80;
+    SLX_FAIL_COND(length < header_size, error_code::image_container_invalid);
+    uint32_t vk_format = read_u32(mem + 12);
+    uint32_t width = read_u32(mem + 20), height = read_u32(mem + 24), depth = read_u32(mem + 28);
+    uint32_t layers = read_u32(mem + 32), faces = read_u32(mem + 36), levels = read_u32(mem + 40);
+    uint32_t supercompression = read_u32(mem + 44);
+    // only plain 2d textures, a level count of 0 asks for generated mipmaps and stores just the base
+    SLX_FAIL_COND(depth > 0 || layers > 0 || faces != 1 || supercompression != 0, error_code::image_format_unsupported);
+    SLX_FAIL_COND(width < 1 || height < 1 || width > INT32_MAX || height > INT32_MAX, error_code::image_container_invalid);
+    levels = levels ? levels : 1;
+    SLX_FAIL_COND(levels > max_container_levels || length < header_size + (int64_t)levels * 24, error_code::image_container_invalid);
+
+    out->format = vk_format_to_image_format(vk_format);
+    SLX_FAIL_COND(out->format == (ImageFormat)-1, error_code::image_format_unsupported);
+    out->width = (int32_t)width;
+    out->height = (int32_t)height;
+    out->levels = (int32_t)levels;
+    for (int32_t level = 0; level < out->levels; level++)
+    {
+        const s_byte* index = mem + header_size + level * 24;
+        if (set_container_level(out, level, read_u64(index), read_u64(index + 8), length))
+            return true;
+    }
+    return false;
+}
+
+// https://learn.microsoft.com/windows/win32/direct3ddds/dds-header
+static s_bool parse_dds(const s_byte* mem, int32_t length, image_container* out)
+{
+    constexpr int32_t header_size = 4 + 124;
+    constexpr int32_t dx10_header_size = 20;
+    constexpr uint32_t ddpf_fourcc = 0x4;
+    constexpr uint32_t ddscaps2_cubemap = 0x200;
+    SLX_FAIL_COND(length < header_size || read_u32(mem + 4) != 124, error_code::image_container_invalid);
+    uint32_t height = read_u32(mem + 12), width = read_u32(mem + 16);
+    uint32_t levels = read_u32(mem + 28);
+    uint32_t pf_flags = read_u32(mem + 80), pf_fourcc = read_u32(mem + 84);
+    uint32_t caps2 = read_u32(mem + 112);
+    SLX_FAIL_COND((pf_flags & ddpf_fourcc) == 0 || (caps2 & ddscaps2_cubemap) != 0, error_code::image_format_unsupported);
+    SLX_FAIL_COND(width < 1 || height < 1 || width > INT32_MAX || height > INT32_MAX, error_code::image_container_invalid);
+    levels = levels ? levels : 1;
+    SLX_FAIL_COND(levels > max_container_levels, error_code::image_container_invalid);
+
+    int32_t offset = header_size;
+    if (pf_fourcc == fourcc('D', 'X', '1', '0'))
+    {
+        SLX_FAIL_COND(length < header_size + dx10_header_size, error_code::image_container_invalid);
+        constexpr uint32_t dimension_texture2d = 3;
+        SLX_FAIL_COND(read_u32(mem + header_size + 4) != dimension_texture2d, error_code::image_format_unsupported);
+        out->format = dxgi_format_to_image_format(read_u32(mem + header_size));
+        offset += dx10_header_size;
+    }
+    else
+    {
+        out->format = dds_fourcc_to_image_format(pf_fourcc);
+    }
+    SLX_FAIL_COND(out->format == (ImageFormat)-1, error_code::image_format_unsupported);
+    out->width = (int32_t)width;
+    out->height = (int32_t)height;
+    out->levels = (int32_t)levels;
+
+    // the levels are stored back to back, only the first array slice is read
+    for (int32_t level = 0; level < out->levels; level++)
+    {
+        int32_t w = out->width >> level, h = out->height >> level;
+        int64_t size = ImageFormat_get_data_size(out->format, w ? w : 1, h ? h : 1);
+        if (set_container_level(out, level, (uint64_t)offset, (uint64_t)size, length))
+            return true;
+        offset += (int32_t)size;
+    }
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_IsImageContainer(P_IN void* mem, int32_t length, P_OUT s_bool* out_is_container)
+{
+    assert(mem != nullptr);
+    assert(out_is_container != nullptr);
+
+    const s_byte* bytes = (const s_byte*)mem;
+    *out_is_container =
+        (length >= (int32_t)sizeof(ktx2_identifier) && memcmp(bytes, ktx2_identifier, sizeof(ktx2_identifier)) == 0) ||
+        (length >= (int32_t)sizeof(dds_magic) && memcmp(bytes, dds_magic, sizeof(dds_magic)) == 0);
+    return false;
+}
+
+SLX_API s_bool SLX_CALLCONV SLX_ParseImageContainer(P_IN void* mem, int32_t length, P_OUT image_container* out_container)
+{
+    assert(mem != nullptr);
+    assert(out_container != nullptr);
+
+    const s_byte* bytes = (const s_byte*)mem;
+    *out_container = {};
+    if (length >= (int32_t)sizeof(ktx2_identifier) && memcmp(bytes, ktx2_identifier, sizeof(ktx2_identifier)) == 0)
+        return parse_ktx2(bytes, length, out_container);
+    if (length >= (int32_t)sizeof(dds_magic) && memcmp(bytes, dds_magic, sizeof(dds_magic)) == 0)
+        return parse_dds(bytes, length, out_container);
+    SLX_FAIL(error_code::image_container_invalid);
+}
+
+#pragma endregion
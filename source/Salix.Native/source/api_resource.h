@@ -1,11 +1,29 @@
-#pragma once
-#ifndef H_API_RESOURCE
-#define H_API_RESOURCE
-
-#include "graphics_enums.h"
-#include "common.h"
-
-SLX_API void* SLX_CALLCONV SLX_LoadImage(void* mem, int length, P_OUT int* x, P_OUT int* y, P_OUT int* data_length, P_OUT ImageFormat* format);
-SLX_API void SLX_CALLCONV SLX_FreeImage(void* texData);
-
+#pragma once
+#ifndef H_API_RESOURCE
+#define H_API_RESOURCE
+
+#include <cstdint>
+#include "graphics_enums.h"
+#include "common.h"
+
+constexpr int32_t max_container_levels = 16;
+
+// ../Salix/Platform/Interop.cs ImageContainer
+struct image_container
+{
+    int32_t width;
+    int32_t height;
+    int32_t levels;
+    ImageFormat format;
+    // into the parsed memory, the largest level first
+    int32_t level_offsets[max_container_levels];
+    int32_t level_sizes[max_container_levels];
+};
+
+SLX_API void* SLX_CALLCONV SLX_LoadImage(void* mem, int length, P_OUT int* x, P_OUT int* y, P_OUT int* data_length, P_OUT ImageFormat* format);
+SLX_API void SLX_CALLCONV SLX_FreeImage(void* texData);
+SLX_API s_bool SLX_CALLCONV SLX_CompressImage(P_IN void* pixels, int32_t width, int32_t height, ImageFormat source_format, ImageFormat target_format, CompressionQuality quality, P_OUT void* out_blocks, int32_t out_size, P_OUT double* out_squared_error, P_OUT int64_t* out_error_samples);
+SLX_API s_bool SLX_CALLCONV SLX_IsImageContainer(P_IN void* mem, int32_t length, P_OUT s_bool* out_is_container);
+SLX_API s_bool SLX_CALLCONV SLX_ParseImageContainer(P_IN void* mem, int32_t length, P_OUT image_container* out_container);
+
 #endif
\ No newline at end of file
@@ -0,0 +1,758 @@
+#include "api_resource.h"
+
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include "error.h"
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__SSE2__)
+#define SLX_COMPRESS_SSE
+#include <emmintrin.h>
+#endif
+
+// block compression of decoded images, every format here works on 4x4 pixel blocks
+// and picks two endpoints per block with the pixels as indices into the colors between them
+
+// a block with its channels split, so the index searches handle four pixels at once
+struct block_pixels
+{
+    alignas(16) float c[4][16];
+};
+
+struct block_encoder
+{
+    CompressionQuality quality;
+    // accumulated only when asked for, the fast mode doesn't need it otherwise
+    bool want_error;
+    double squared_error;
+    // the channel values the error is summed over, transparent bc1 pixels are not measured
+    int64_t error_samples;
+};
+
+static void fetch_block(const s_byte* src, int32_t width, int32_t height, int32_t channels, int32_t bx, int32_t by, block_pixels* out)
+{
+    for (int32_t i = 0; i < 16; i++)
+    {
+        // blocks hanging over the image edge repeat its last column and row
+        int32_t x = bx + (i & 3), y = by + (i >> 2);
+        x = x < width ? x : width - 1;
+        y = y < height ? y : height - 1;
+        const s_byte* p = src + ((size_t)y * width + x) * channels;
+        out->c[0][i] = p[0];
+        out->c[1][i] = channels > 1 ? p[1] : 0.0f;
+        out->c[2][i] = channels > 2 ? p[2] : 0.0f;
+        out->c[3][i] = channels > 3 ? p[3] : 255.0f;
+    }
+}
+
+static float clamp_channel(float v)
+{
+    return v < 0.0f ? 0.0f : v > 255.0f ? 255.0f : v;
+}
+
+#pragma region endpoint search
+
+// endpoints on the principal axis of the pixels selected by 'mask', found by power iteration on their covariance,
+// 'inset' pulls them in by a fraction of the range as the extremes are rarely the best fit
+static void principal_endpoints(const float (*c)[16], int32_t channels, uint32_t mask, int32_t iterations, float inset, float e0[4], float e1[4])
+{
+    float mean[4] = {};
+    int32_t count = 0;
+    for (int32_t i = 0; i < 16; i++)
+    {
+        if (!(mask >> i & 1)) continue;
+        for (int32_t ch = 0; ch < channels; ch++)
+            mean[ch] += c[ch][i];
+        count++;
+    }
+    for (int32_t ch = 0; ch < channels; ch++)
+        mean[ch] /= count;
+
+    float cov[4][4] = {};
+    for (int32_t i = 0; i < 16; i++)
+    {
+        if (!(mask >> i & 1)) continue;
+        for (int32_t j = 0; j < channels; j++)
+            for (int32_t k = 0; k < channels; k++)
+                cov[j][k] += (c[j][i] - mean[j]) * (c[k][i] - mean[k]);
+    }
+
+    // the covariance row of the widest channel already carries the signs between channels
+    int32_t widest = 0;
+    for (int32_t ch = 1; ch < channels; ch++)
+        if (cov[ch][ch] > cov[widest][widest]) widest = ch;
+    float axis[4] = {};
+    for (int32_t ch = 0; ch < channels; ch++)
+        axis[ch] = cov[widest][ch];
+    for (int32_t it = 0; it < iterations; it++)
+    {
+        float next[4] = {};
+        float largest = 0.0f;
+        for (int32_t j = 0; j < channels; j++)
+        {
+            for (int32_t k = 0; k < channels; k++)
+                next[j] += cov[j][k] * axis[k];
+            largest = fabsf(next[j]) > largest ? fabsf(next[j]) : largest;
+        }
+        if (largest < 1e-6f) break;
+        for (int32_t ch = 0; ch < channels; ch++)
+            axis[ch] = next[ch] / largest;
+    }
+
+    float length = 0.0f;
+    for (int32_t ch = 0; ch < channels; ch++)
+        length += axis[ch] * axis[ch];
+    if (length < 1e-12f)
+    {
+        // a flat block
+        for (int32_t ch = 0; ch < 4; ch++)
+            e0[ch] = e1[ch] = ch < channels ? mean[ch] : 255.0f;
+        return;
+    }
+    length = sqrtf(length);
+    for (int32_t ch = 0; ch < channels; ch++)
+        axis[ch] /= length;
+
+    float tmin = FLT_MAX, tmax = -FLT_MAX;
+    for (int32_t i = 0; i < 16; i++)
+    {
+        if (!(mask >> i & 1)) continue;
+        float t = 0.0f;
+        for (int32_t ch = 0; ch < channels; ch++)
+            t += (c[ch][i] - mean[ch]) * axis[ch];
+        tmin = t < tmin ? t : tmin;
+        tmax = t > tmax ? t : tmax;
+    }
+    float range = tmax - tmin;
+    tmin += range * inset;
+    tmax -= range * inset;
+    for (int32_t ch = 0; ch < 4; ch++)
+    {
+        e0[ch] = ch < channels ? clamp_channel(mean[ch] + axis[ch] * tmin) : 255.0f;
+        e1[ch] = ch < channels ? clamp_channel(mean[ch] + axis[ch] * tmax) : 255.0f;
+    }
+}
+
+// endpoints with the least squared error for fixed indices, 'w' is each pixel's position from e0 to e1
+static bool least_squares_endpoints(const float (*c)[16], int32_t channels, const float w[16], float e0[4], float e1[4])
+{
+    float aa = 0.0f, ab = 0.0f, bb = 0.0f;
+    float x0[4] = {}, x1[4] = {};
+    for (int32_t i = 0; i < 16; i++)
+    {
+        float a = 1.0f - w[i], b = w[i];
+        aa += a * a;
+        ab += a * b;
+        bb += b * b;
+        for (int32_t ch = 0; ch < channels; ch++)
+        {
+            x0[ch] += a * c[ch][i];
+            x1[ch] += b * c[ch][i];
+        }
+    }
+    float det = aa * bb - ab * ab;
+    if (fabsf(det) < 1e-6f)
+        return false;
+    for (int32_t ch = 0; ch < channels; ch++)
+    {
+        e0[ch] = clamp_channel((bb * x0[ch] - ab * x1[ch]) / det);
+        e1[ch] = clamp_channel((aa * x1[ch] - ab * x0[ch]) / det);
+    }
+    return true;
+}
+
+#pragma endregion
+
+#pragma region index search
+
+// the fast path, each pixel is projected on the line e0-e1 and rounded to one of 'levels' evenly spaced steps
+static void project_indices(const float (*c)[16], int32_t channels, const float e0[4], const float e1[4], int32_t levels, int32_t idx[16])
+{
+    float dir[4] = {};
+    float length = 0.0f;
+    for (int32_t ch = 0; ch < channels; ch++)
+    {
+        dir[ch] = e1[ch] - e0[ch];
+        length += dir[ch] * dir[ch];
+    }
+    if (length < 1e-6f)
+    {
+        memset(idx, 0, 16 * sizeof(int32_t));
+        return;
+    }
+    float scale = (levels - 1) / length;
+
+#ifdef SLX_COMPRESS_SSE
+    const __m128 half = _mm_set1_ps(0.5f);
+    const __m128 top = _mm_set1_ps((float)(levels - 1));
+    for (int32_t i = 0; i < 16; i += 4)
+    {
+        __m128 dot = _mm_setzero_ps();
+        for (int32_t ch = 0; ch < channels; ch++)
+        {
+            __m128 d = _mm_sub_ps(_mm_load_ps(&c[ch][i]), _mm_set1_ps(e0[ch]));
+            dot = _mm_add_ps(dot, _mm_mul_ps(d, _mm_set1_ps(dir[ch])));
+        }
+        __m128 t = _mm_add_ps(_mm_mul_ps(dot, _mm_set1_ps(scale)), half);
+        t = _mm_min_ps(_mm_max_ps(t, _mm_setzero_ps()), top);
+        _mm_storeu_si128((__m128i*)&idx[i], _mm_cvttps_epi32(t));
+    }
+#else
+    for (int32_t i = 0; i < 16; i++)
+    {
+        float dot = 0.0f;
+        for (int32_t ch = 0; ch < channels; ch++)
+            dot += (c[ch][i] - e0[ch]) * dir[ch];
+        float t = dot * scale + 0.5f;
+        t = t < 0.0f ? 0.0f : t > levels - 1 ? levels - 1 : t;
+        idx[i] = (int32_t)t;
+    }
+#endif
+}
+
+// the exact search, the nearest palette entry of every pixel selected by 'mask', returns the squared error
+static float nearest_indices(const float (*c)[16], int32_t channels, uint32_t mask, const float (*palette)[4], int32_t levels, int32_t idx[16])
+{
+    float error = 0.0f;
+#ifdef SLX_COMPRESS_SSE
+    for (int32_t i = 0; i < 16; i += 4)
+    {
+        __m128 best = _mm_set1_ps(FLT_MAX);
+        __m128i best_index = _mm_setzero_si128();
+        for (int32_t p = 0; p < levels; p++)
+        {
+            __m128 dist = _mm_setzero_ps();
+            for (int32_t ch = 0; ch < channels; ch++)
+            {
+                __m128 d = _mm_sub_ps(_mm_load_ps(&c[ch][i]), _mm_set1_ps(palette[p][ch]));
+                dist = _mm_add_ps(dist, _mm_mul_ps(d, d));
+            }
+            __m128i closer = _mm_castps_si128(_mm_cmplt_ps(dist, best));
+            best = _mm_min_ps(dist, best);
+            best_index = _mm_or_si128(_mm_andnot_si128(closer, best_index), _mm_and_si128(closer, _mm_set1_epi32(p)));
+        }
+        alignas(16) float dists[4];
+        _mm_store_ps(dists, best);
+        _mm_storeu_si128((__m128i*)&idx[i], best_index);
+        for (int32_t j = 0; j < 4; j++)
+            if (mask >> (i + j) & 1) error += dists[j];
+    }
+#else
+    for (int32_t i = 0; i < 16; i++)
+    {
+        float best = FLT_MAX;
+        for (int32_t p = 0; p < levels; p++)
+        {
+            float dist = 0.0f;
+            for (int32_t ch = 0; ch < channels; ch++)
+                dist += (c[ch][i] - palette[p][ch]) * (c[ch][i] - palette[p][ch]);
+            if (dist < best)
+            {
+                best = dist;
+                idx[i] = p;
+            }
+        }
+        if (mask >> i & 1) error += best;
+    }
+#endif
+    return error;
+}
+
+static float indices_error(const float (*c)[16], int32_t channels, uint32_t mask, const float (*palette)[4], const int32_t idx[16])
+{
+    float error = 0.0f;
+    for (int32_t i = 0; i < 16; i++)
+    {
+        if (!(mask >> i & 1)) continue;
+        for (int32_t ch = 0; ch < channels; ch++)
+            error += (c[ch][i] - palette[idx[i]][ch]) * (c[ch][i] - palette[idx[i]][ch]);
+    }
+    return error;
+}
+
+#pragma endregion
+
+#pragma region bc1
+
+static uint16_t bc1_quantize(const float e[4])
+{
+    int32_t r = (int32_t)(e[0] * 31.0f / 255.0f + 0.5f);
+    int32_t g = (int32_t)(e[1] * 63.0f / 255.0f + 0.5f);
+    int32_t b = (int32_t)(e[2] * 31.0f / 255.0f + 0.5f);
+    return (uint16_t)(r << 11 | g << 5 | b);
+}
+
+static void bc1_expand(uint16_t v, float out[4])
+{
+    int32_t r = v >> 11, g = v >> 5 & 63, b = v & 31;
+    out[0] = (float)(r << 3 | r >> 2);
+    out[1] = (float)(g << 2 | g >> 4);
+    out[2] = (float)(b << 3 | b >> 2);
+    out[3] = 255.0f;
+}
+
+// palette order as decoded: the endpoints first, then the colors between them
+static void bc1_palette(uint16_t c0, uint16_t c1, bool three_color, float palette[4][4])
+{
+    bc1_expand(c0, palette[0]);
+    bc1_expand(c1, palette[1]);
+    for (int32_t ch = 0; ch < 4; ch++)
+    {
+        if (three_color)
+        {
+            palette[2][ch] = (palette[0][ch] + palette[1][ch]) / 2.0f;
+            palette[3][ch] = 0.0f;
+        }
+        else
+        {
+            palette[2][ch] = (palette[0][ch] * 2.0f + palette[1][ch]) / 3.0f;
+            palette[3][ch] = (palette[0][ch] + palette[1][ch] * 2.0f) / 3.0f;
+        }
+    }
+}
+
+// indices of the evenly spaced steps from c0 to c1 in palette order
+static const int32_t bc1_step_to_index[4] = { 0, 2, 3, 1 };
+static const float bc1_index_weight[4] = { 0.0f, 1.0f, 1.0f / 3.0f, 2.0f / 3.0f };
+
+struct bc1_candidate
+{
+    uint16_t c0, c1;
+    int32_t idx[16];
+    float error;
+};
+
+static void bc1_evaluate(const block_pixels& b, uint16_t c0, uint16_t c1, const float e0[4], const float e1[4], bool exact, bool want_error, bc1_candidate* out)
+{
+    float palette[4][4];
+    bc1_palette(c0, c1, false, palette);
+    out->c0 = c0;
+    out->c1 = c1;
+    if (exact)
+    {
+        out->error = nearest_indices(b.c, 3, 0xFFFF, palette, 4, out->idx);
+        return;
+    }
+    project_indices(b.c, 3, e0, e1, 4, out->idx);
+    for (int32_t i = 0; i < 16; i++)
+        out->idx[i] = bc1_step_to_index[out->idx[i]];
+    out->error = want_error ? indices_error(b.c, 3, 0xFFFF, palette, out->idx) : 0.0f;
+}
+
+static void bc1_write(uint16_t c0, uint16_t c1, const int32_t idx[16], s_byte out[8])
+{
+    uint32_t bits = 0;
+    for (int32_t i = 0; i < 16; i++)
+        bits |= (uint32_t)idx[i] << (i * 2);
+    memcpy(out, &c0, 2);
+    memcpy(out + 2, &c1, 2);
+    memcpy(out + 4, &bits, 4);
+}
+
+// opaque blocks use the four color mode, c0 > c1, which is also the only mode of the bc3 color block
+static void encode_bc1_opaque(const block_pixels& b, block_encoder* enc, s_byte out[8])
+{
+    bool high = enc->quality == CompressionQuality::High;
+    float e0[4], e1[4];
+    principal_endpoints(b.c, 3, 0xFFFF, high ? 8 : 2, high ? 0.0f : 1.0f / 16.0f, e0, e1);
+
+    bc1_candidate best;
+    bc1_evaluate(b, bc1_quantize(e0), bc1_quantize(e1), e0, e1, high, enc->want_error, &best);
+    if (high)
+    {
+        for (int32_t it = 0; it < 2 && best.error > 0.0f; it++)
+        {
+            float w[16];
+            for (int32_t i = 0; i < 16; i++)
+                w[i] = bc1_index_weight[best.idx[i]];
+            if (!least_squares_endpoints(b.c, 3, w, e0, e1))
+                break;
+            bc1_candidate refined;
+            bc1_evaluate(b, bc1_quantize(e0), bc1_quantize(e1), e0, e1, true, true, &refined);
+            if (refined.error >= best.error)
+                break;
+            best = refined;
+        }
+    }
+
+    // the endpoints in decreasing order select the four color mode, the indices follow the swap
+    if (best.c0 < best.c1)
+    {
+        uint16_t t = best.c0;
+        best.c0 = best.c1;
+        best.c1 = t;
+        for (int32_t i = 0; i < 16; i++)
+            best.idx[i] ^= 1;
+    }
+    else if (best.c0 == best.c1)
+    {
+        memset(best.idx, 0, sizeof(best.idx));
+    }
+    enc->squared_error += best.error;
+    enc->error_samples += 16 * 3;
+    bc1_write(best.c0, best.c1, best.idx, out);
+}
+
+// blocks with pixels under half alpha use the three color mode, c0 <= c1, its last index is transparent black
+static void encode_bc1_punchthrough(const block_pixels& b, uint32_t opaque, block_encoder* enc, s_byte out[8])
+{
+    bool high = enc->quality == CompressionQuality::High;
+    int32_t idx[16] = {};
+    uint16_t c0 = 0, c1 = 0;
+    float error = 0.0f;
+    if (opaque)
+    {
+        float e0[4], e1[4];
+        principal_endpoints(b.c, 3, opaque, high ? 8 : 2, 0.0f, e0, e1);
+        c0 = bc1_quantize(e0);
+        c1 = bc1_quantize(e1);
+        if (c0 > c1)
+        {
+            uint16_t t = c0;
+            c0 = c1;
+            c1 = t;
+        }
+        float palette[4][4];
+        bc1_palette(c0, c1, true, palette);
+        error = nearest_indices(b.c, 3, opaque, palette, 3, idx);
+    }
+    for (int32_t i = 0; i < 16; i++)
+    {
+        if (!(opaque >> i & 1)) idx[i] = 3;
+        else enc->error_samples += 3;
+    }
+    enc->squared_error += error;
+    bc1_write(c0, c1, idx, out);
+}
+
+static void encode_bc1(const block_pixels& b, block_encoder* enc, s_byte out[8])
+{
+    uint32_t opaque = 0;
+    for (int32_t i = 0; i < 16; i++)
+        opaque |= (b.c[3][i] >= 128.0f ? 1u : 0u) << i;
+    if (opaque == 0xFFFF)
+        encode_bc1_opaque(b, enc, out);
+    else
+        encode_bc1_punchthrough(b, opaque, enc, out);
+}
+
+#pragma endregion
+
+#pragma region bc4
+
+// a single channel, the a0 > a1 mode interpolates six values between the endpoints,
+// the a0 <= a1 mode four, plus exact 0 and 255
+static void bc4_palette(int32_t a0, int32_t a1, float palette[8][4])
+{
+    palette[0][0] = (float)a0;
+    palette[1][0] = (float)a1;
+    if (a0 > a1)
+    {
+        for (int32_t k = 2; k < 8; k++)
+            palette[k][0] = (float)((8 - k) * a0 + (k - 1) * a1) / 7.0f;
+    }
+    else
+    {
+        for (int32_t k = 2; k < 6; k++)
+            palette[k][0] = (float)((6 - k) * a0 + (k - 1) * a1) / 5.0f;
+        palette[6][0] = 0.0f;
+        palette[7][0] = 255.0f;
+    }
+}
+
+static void bc4_write(int32_t a0, int32_t a1, const int32_t idx[16], s_byte out[8])
+{
+    uint64_t bits = 0;
+    for (int32_t i = 0; i < 16; i++)
+        bits |= (uint64_t)idx[i] << (i * 3);
+    out[0] = (s_byte)a0;
+    out[1] = (s_byte)a1;
+    for (int32_t i = 0; i < 6; i++)
+        out[2 + i] = (s_byte)(bits >> (i * 8));
+}
+
+static void encode_bc4(const float (*c)[16], block_encoder* enc, s_byte out[8])
+{
+    float lo = 255.0f, hi = 0.0f;
+    for (int32_t i = 0; i < 16; i++)
+    {
+        lo = c[0][i] < lo ? c[0][i] : lo;
+        hi = c[0][i] > hi ? c[0][i] : hi;
+    }
+    int32_t a0 = (int32_t)(hi + 0.5f), a1 = (int32_t)(lo + 0.5f);
+    int32_t idx[16] = {};
+    float palette[8][4];
+    float error = 0.0f;
+    if (a0 == a1)
+    {
+        bc4_palette(a0, a1, palette);
+        error = enc->want_error ? indices_error(c, 1, 0xFFFF, palette, idx) : 0.0f;
+    }
+    else if (enc->quality == CompressionQuality::High)
+    {
+        bc4_palette(a0, a1, palette);
+        error = nearest_indices(c, 1, 0xFFFF, palette, 8, idx);
+
+        // the a0 <= a1 mode can win when the block reaches 0 or 255, its four inner values span the rest and 0 and 255 are exact
+        float inner_lo = 255.0f, inner_hi = 0.0f;
+        for (int32_t i = 0; i < 16; i++)
+        {
+            if (c[0][i] <= 0.0f || c[0][i] >= 255.0f) continue;
+            inner_lo = c[0][i] < inner_lo ? c[0][i] : inner_lo;
+            inner_hi = c[0][i] > inner_hi ? c[0][i] : inner_hi;
+        }
+        if (inner_lo <= inner_hi && (lo <= 0.0f || hi >= 255.0f))
+        {
+            int32_t b0 = (int32_t)(inner_lo + 0.5f), b1 = (int32_t)(inner_hi + 0.5f);
+            float inner_palette[8][4];
+            int32_t inner_idx[16];
+            bc4_palette(b0, b1, inner_palette);
+            float inner_error = nearest_indices(c, 1, 0xFFFF, inner_palette, 8, inner_idx);
+            if (inner_error < error)
+            {
+                a0 = b0;
+                a1 = b1;
+                error = inner_error;
+                memcpy(idx, inner_idx, sizeof(idx));
+            }
+        }
+    }
+    else
+    {
+        // steps from a1 up to a0, the inner steps are stored from a0 down
+        float e0[4] = { (float)a1 }, e1[4] = { (float)a0 };
+        project_indices(c, 1, e0, e1, 8, idx);
+        for (int32_t i = 0; i < 16; i++)
+            idx[i] = idx[i] == 0 ? 1 : idx[i] == 7 ? 0 : 8 - idx[i];
+        bc4_palette(a0, a1, palette);
+        error = enc->want_error ? indices_error(c, 1, 0xFFFF, palette, idx) : 0.0f;
+    }
+    enc->squared_error += error;
+    enc->error_samples += 16;
+    bc4_write(a0, a1, idx, out);
+}
+
+#pragma endregion
+
+#pragma region bc7
+
+// only mode 6 is used: one subset, rgba endpoints of 7 bits plus a p-bit each and 4 bit indices,
+// which covers smooth color and alpha well and keeps the search small
+
+static const int32_t bc7_weights[16] = { 0, 4, 9, 13, 17, 21, 26, 30, 34, 38, 43, 47, 51, 55, 60, 64 };
+
+struct bc7_endpoint
+{
+    int32_t q[4];
+    int32_t p;
+};
+
+static bc7_endpoint bc7_quantize(const float e[4], int32_t p)
+{
+    bc7_endpoint out;
+    out.p = p;
+    for (int32_t ch = 0; ch < 4; ch++)
+    {
+        int32_t v = (int32_t)floorf((e[ch] - p) / 2.0f + 0.5f);
+        out.q[ch] = v < 0 ? 0 : v > 127 ? 127 : v;
+    }
+    return out;
+}
+
+// the p-bit with the smaller quantization error
+static bc7_endpoint bc7_quantize_best(const float e[4])
+{
+    bc7_endpoint best = bc7_quantize(e, 0);
+    bc7_endpoint odd = bc7_quantize(e, 1);
+    float best_error = 0.0f, odd_error = 0.0f;
+    for (int32_t ch = 0; ch < 4; ch++)
+    {
+        float d0 = e[ch] - (best.q[ch] << 1 | best.p), d1 = e[ch] - (odd.q[ch] << 1 | odd.p);
+        best_error += d0 * d0;
+        odd_error += d1 * d1;
+    }
+    return odd_error < best_error ? odd : best;
+}
+
+static void bc7_palette(const bc7_endpoint& e0, const bc7_endpoint& e1, float palette[16][4])
+{
+    for (int32_t ch = 0; ch < 4; ch++)
+    {
+        int32_t a = e0.q[ch] << 1 | e0.p, b = e1.q[ch] << 1 | e1.p;
+        for (int32_t i = 0; i < 16; i++)
+            palette[i][ch] = (float)(((64 - bc7_weights[i]) * a + bc7_weights[i] * b + 32) >> 6);
+    }
+}
+
+static void bc7_dequantize(const bc7_endpoint& e, float out[4])
+{
+    for (int32_t ch = 0; ch < 4; ch++)
+        out[ch] = (float)(e.q[ch] << 1 | e.p);
+}
+
+struct bc7_candidate
+{
+    bc7_endpoint e0, e1;
+    int32_t idx[16];
+    float error;
+};
+
+static void bc7_evaluate(const block_pixels& b, const bc7_endpoint& e0, const bc7_endpoint& e1, bool exact, bool want_error, bc7_candidate* out)
+{
+    float palette[16][4];
+    bc7_palette(e0, e1, palette);
+    out->e0 = e0;
+    out->e1 = e1;
+    if (exact)
+    {
+        out->error = nearest_indices(b.c, 4, 0xFFFF, palette, 16, out->idx);
+        return;
+    }
+    float d0[4], d1[4];
+    bc7_dequantize(e0, d0);
+    bc7_dequantize(e1, d1);
+    project_indices(b.c, 4, d0, d1, 16, out->idx);
+    out->error = want_error ? indices_error(b.c, 4, 0xFFFF, palette, out->idx) : 0.0f;
+}
+
+struct bit_writer
+{
+    uint64_t bits[2];
+    int32_t pos;
+
+    void put(uint32_t value, int32_t count)
+    {
+        for (int32_t i = 0; i < count; i++, pos++)
+            bits[pos >> 6] |= (uint64_t)(value >> i & 1) << (pos & 63);
+    }
+};
+
+static void bc7_write(bc7_candidate& block, s_byte out[16])
+{
+    // the first index is stored without its top bit, which the endpoint order makes 0
+    if (block.idx[0] >= 8)
+    {
+        bc7_endpoint t = block.e0;
+        block.e0 = block.e1;
+        block.e1 = t;
+        for (int32_t i = 0; i < 16; i++)
+            block.idx[i] = 15 - block.idx[i];
+    }
+
+    bit_writer w = {};
+    w.put(1 << 6, 7);
+    for (int32_t ch = 0; ch < 4; ch++)
+    {
+        w.put(block.e0.q[ch], 7);
+        w.put(block.e1.q[ch], 7);
+    }
+    w.put(block.e0.p, 1);
+    w.put(block.e1.p, 1);
+    w.put(block.idx[0], 3);
+    for (int32_t i = 1; i < 16; i++)
+        w.put(block.idx[i], 4);
+    memcpy(out, w.bits, 16);
+}
+
+static void encode_bc7(const block_pixels& b, block_encoder* enc, s_byte out[16])
+{
+    bool high = enc->quality == CompressionQuality::High;
+    float e0[4], e1[4];
+    principal_endpoints(b.c, 4, 0xFFFF, high ? 8 : 2, high ? 0.0f : 1.0f / 32.0f, e0, e1);
+
+    bc7_candidate best;
+    if (!high)
+    {
+        bc7_evaluate(b, bc7_quantize_best(e0), bc7_quantize_best(e1), false, enc->want_error, &best);
+    }
+    else
+    {
+        best.error = FLT_MAX;
+        for (int32_t it = 0; it < 3; it++)
+        {
+            // every p-bit pair, the rounding they cause differs per channel
+            bc7_candidate round_best;
+            round_best.error = FLT_MAX;
+            for (int32_t p = 0; p < 4; p++)
+            {
+                bc7_candidate candidate;
+                bc7_evaluate(b, bc7_quantize(e0, p & 1), bc7_quantize(e1, p >> 1), true, true, &candidate);
+                if (candidate.error < round_best.error)
+                    round_best = candidate;
+            }
+            if (round_best.error >= best.error)
+                break;
+            best = round_best;
+            if (best.error == 0.0f)
+                break;
+
+            float w[16];
+            for (int32_t i = 0; i < 16; i++)
+                w[i] = bc7_weights[best.idx[i]] / 64.0f;
+            if (!least_squares_endpoints(b.c, 4, w, e0, e1))
+                break;
+        }
+    }
+    enc->squared_error += best.error;
+    enc->error_samples += 16 * 4;
+    bc7_write(best, out);
+}
+
+#pragma endregion
+
+SLX_API s_bool SLX_CALLCONV SLX_CompressImage(
+    P_IN void* pixels, int32_t width, int32_t height, ImageFormat source_format,
+    ImageFormat target_format, CompressionQuality quality,
+    P_OUT void* out_blocks, int32_t out_size, P_OUT double* out_squared_error, P_OUT int64_t* out_error_samples
+)
+{
+    assert(pixels != nullptr);
+    assert(width >= 1);
+    assert(height >= 1);
+    assert(out_blocks != nullptr);
+
+    SLX_FAIL_COND(ImageFormat_is_compressed(source_format), error_code::invalid_parameter);
+    SLX_FAIL_COND(!ImageFormat_is_compressed(target_format), error_code::invalid_parameter);
+    SLX_FAIL_COND(ImageFormat_get_data_size(target_format, width, height) > out_size, error_code::invalid_parameter);
+
+    int32_t channels = ImageFormat_get_size(source_format);
+    int32_t block_size = ImageFormat_get_size(target_format);
+    block_encoder enc = { quality, out_squared_error != nullptr, 0.0, 0 };
+    const s_byte* src = (const s_byte*)pixels;
+    s_byte* dst = (s_byte*)out_blocks;
+    block_pixels block;
+    for (int32_t by = 0; by < height; by += 4)
+    {
+        for (int32_t bx = 0; bx < width; bx += 4, dst += block_size)
+        {
+            fetch_block(src, width, height, channels, bx, by, &block);
+            switch (target_format)
+            {
+            case ImageFormat::Bc1:
+                encode_bc1(block, &enc, dst);
+                break;
+            case ImageFormat::Bc3:
+                encode_bc4(&block.c[3], &enc, dst);
+                encode_bc1_opaque(block, &enc, dst + 8);
+                break;
+            case ImageFormat::Bc4:
+                encode_bc4(&block.c[0], &enc, dst);
+                break;
+            case ImageFormat::Bc5:
+                encode_bc4(&block.c[0], &enc, dst);
+                encode_bc4(&block.c[1], &enc, dst + 8);
+                break;
+            case ImageFormat::Bc7:
+                encode_bc7(block, &enc, dst);
+                break;
+            default:
+                SLX_FAIL(error_code::enum_mapping_failed);
+            }
+        }
+    }
+    if (out_squared_error)
+        *out_squared_error = enc.squared_error;
+    if (out_error_samples)
+        *out_error_samples = enc.error_samples;
+    return false;
+}
@@ -1,10 +1,10 @@
-#pragma once
-#ifndef H_API_SYSTEM
-#define H_API_SYSTEM
-
-#include "common.h"
-#include "error.h"
-
-SLX_API s_bool SLX_CALLCONV SLX_Initialize();
-
+#pragma once
+#ifndef H_API_SYSTEM
+#define H_API_SYSTEM
+
+#include "common.h"
+#include "error.h"
+
+SLX_API s_bool SLX_CALLCONV SLX_Initialize();
+
 #endif
\ No newline at end of file
@@ -1,160 +1,283 @@
-#pragma once
-#ifndef H_ENUMS_GRAPHICS
-#define H_ENUMS_GRAPHICS
-
-#include <assert.h>
-#include <glad/glad.h>
-
-// ../Salix/Graphics/Vertex/VertexElementType.cs
-enum class VertexElementType
-{
-    Single,
-    Color,
-    Vector2,
-    Vector3,
-    Vector4,
-};
-
-// ../Salix/Graphics/Vertex/PrimitiveType.cs
-enum class PrimitiveType
-{
-    TriangleList,
-    TriangleStrip,
-    TriangleFan,
-    LineList,
-    LineStrip,
-    PointList
-};
-
-// ../Salix/Graphics/Vertex/VertexBufferDataUsage.cs
-enum class VertexBufferDataUsage
-{
-    StaticDraw,
-    DynamicDraw,
-    StreamDraw
-};
-
-// ../Salix/Graphics/ImageFormat.cs
-enum class ImageFormat
-{
-    R8,
-    Rg16,
-    Rgb24,
-    Rgba32
-};
-
-// ../Salix/Graphics/TextureFilterType.cs
-enum class TextureFilterType
-{
-    Linear,
-    Nearest,
-    LinearMipmapLinear,
-    LinearMipmapNearest,
-    NearestMipmapLinear,
-    NearestMipmapNearest
-};
-
-// ../Salix/Graphics/TextureWrapType.cs
-enum class TextureWrapType
-{
-    ClampToEdge,
-    Repeat,
-    MirroredRepeat
-};
-
-struct vertex_element_glinfo { int count; GLenum type; GLsizei componentSize; };
-inline vertex_element_glinfo VertexElementType_get_glinfo(VertexElementType type)
-{
-    switch (type)
-    {
-    case VertexElementType::Color: return vertex_element_glinfo{ 4, GL_FLOAT, sizeof(float) };
-    case VertexElementType::Single: return vertex_element_glinfo{ 1, GL_FLOAT, sizeof(float) };
-    case VertexElementType::Vector2: return vertex_element_glinfo{ 2, GL_FLOAT, sizeof(float) };
-    case VertexElementType::Vector3: return vertex_element_glinfo{ 3, GL_FLOAT, sizeof(float) };
-    case VertexElementType::Vector4: return vertex_element_glinfo{ 4, GL_FLOAT, sizeof(float) };
-    }
-    assert(false);
-    return vertex_element_glinfo{ 0, 0, 0 };
-}
-
-inline GLenum PrimitiveType_get_glinfo(PrimitiveType type)
-{
-    switch (type)
-    {
-    case PrimitiveType::LineList: return GL_LINES;
-    case PrimitiveType::LineStrip: return GL_LINE_STRIP;
-    case PrimitiveType::PointList: return GL_POINTS;
-    case PrimitiveType::TriangleFan: return GL_TRIANGLE_FAN;
-    case PrimitiveType::TriangleList: return GL_TRIANGLES;
-    case PrimitiveType::TriangleStrip: return GL_TRIANGLE_STRIP;
-    }
-    assert(false);
-    return -1;
-}
-
-inline GLenum VertexBufferDataUsage_to_gl(VertexBufferDataUsage type)
-{
-    switch (type)
-    {
-    case VertexBufferDataUsage::StreamDraw: return GL_STREAM_DRAW;
-    case VertexBufferDataUsage::StaticDraw: return GL_STATIC_DRAW;
-    case VertexBufferDataUsage::DynamicDraw: return GL_DYNAMIC_DRAW;
-    }
-    assert(false);
-    return -1;
-}
-
-inline GLenum ImageFormat_to_gl(ImageFormat format)
-{
-    switch (format)
-    {
-    case ImageFormat::R8: return GL_RED;
-    case ImageFormat::Rg16: return GL_RG;
-    case ImageFormat::Rgb24: return GL_RGB;
-    case ImageFormat::Rgba32: return GL_RGBA;
-    }
-    assert(false);
-    return -1;
-}
-
-inline int ImageFormat_get_size(ImageFormat format)
-{
-    switch (format)
-    {
-    case ImageFormat::R8: return 1;
-    case ImageFormat::Rg16: return 2;
-    case ImageFormat::Rgb24: return 3;
-    case ImageFormat::Rgba32: return 4;
-    }
-    assert(false);
-    return -1;
-}
-
-inline GLenum TextureFilterType_to_gl(TextureFilterType type)
-{
-    switch (type)
-    {
-    case TextureFilterType::Linear: return GL_LINEAR;
-    case TextureFilterType::Nearest: return GL_NEAREST;
-    case TextureFilterType::LinearMipmapLinear: return GL_LINEAR_MIPMAP_LINEAR;
-    case TextureFilterType::LinearMipmapNearest: return GL_LINEAR_MIPMAP_NEAREST;
-    case TextureFilterType::NearestMipmapLinear: return GL_NEAREST_MIPMAP_LINEAR;
-    case TextureFilterType::NearestMipmapNearest: return GL_NEAREST_MIPMAP_NEAREST;
-    }
-    assert(false);
-    return -1;
-}
-
-inline GLenum TextureWrapType_to_gl(TextureWrapType type)
-{
-    switch (type)
-    {
-    case TextureWrapType::ClampToEdge: return GL_CLAMP_TO_EDGE;
-    case TextureWrapType::Repeat: return GL_REPEAT;
-    case TextureWrapType::MirroredRepeat: return GL_MIRRORED_REPEAT;
-    }
-    assert(false);
-    return -1;
-}
-
+#pragma once
+#ifndef H_ENUMS_GRAPHICS
+#define H_ENUMS_GRAPHICS
+
+#include <assert.h>
+#include <cstdint>
+#include <glad/glad.h>
+
+// ../Salix/Graphics/Vertex/VertexElementType.cs
+enum class VertexElementType
+{
+    Single,
+    Color,
+    Vector2,
+    Vector3,
+    Vector4,
+};
+
+// ../Salix/Graphics/Vertex/PrimitiveType.cs
+enum class PrimitiveType
+{
+    TriangleList,
+    TriangleStrip,
+    TriangleFan,
+    LineList,
+    LineStrip,
+    PointList
+};
+
+// ../Salix/Graphics/Vertex/VertexBufferDataUsage.cs
+enum class VertexBufferDataUsage
+{
+    StaticDraw,
+    DynamicDraw,
+    StreamDraw
+};
+
+// ../Salix/Graphics/Vertex/IndexType.cs
+enum class IndexType
+{
+    UInt8,
+    UInt16,
+    UInt32
+};
+
+// ../Salix/Graphics/ImageFormat.cs
+enum class ImageFormat
+{
+    R8,
+    Rg16,
+    Rgb24,
+    Rgba32,
+    // compressed in 4x4 blocks, uploaded by glCompressedTex*
+    Bc1,
+    Bc3,
+    Bc4,
+    Bc5,
+    Bc7
+};
+
+// ../Salix/Graphics/CompressionQuality.cs
+enum class CompressionQuality
+{
+    Fast,
+    High
+};
+
+// ../Salix/Graphics/TextureFilterType.cs
+enum class TextureFilterType
+{
+    Linear,
+    Nearest,
+    LinearMipmapLinear,
+    LinearMipmapNearest,
+    NearestMipmapLinear,
+    NearestMipmapNearest
+};
+
+// ../Salix/Graphics/TextureWrapType.cs
+enum class TextureWrapType
+{
+    ClampToEdge,
+    Repeat,
+    MirroredRepeat
+};
+
+struct vertex_element_glinfo { int count; GLenum type; GLsizei componentSize; };
+inline vertex_element_glinfo VertexElementType_get_glinfo(VertexElementType type)
+{
+    switch (type)
+    {
+    case VertexElementType::Color: return vertex_element_glinfo{ 4, GL_FLOAT, sizeof(float) };
+    case VertexElementType::Single: return vertex_element_glinfo{ 1, GL_FLOAT, sizeof(float) };
+    case VertexElementType::Vector2: return vertex_element_glinfo{ 2, GL_FLOAT, sizeof(float) };
+    case VertexElementType::Vector3: return vertex_element_glinfo{ 3, GL_FLOAT, sizeof(float) };
+    case VertexElementType::Vector4: return vertex_element_glinfo{ 4, GL_FLOAT, sizeof(float) };
+    }
+    assert(false);
+    return vertex_element_glinfo{ 0, 0, 0 };
+}
+
+inline GLenum PrimitiveType_get_glinfo(PrimitiveType type)
+{
+    switch (type)
+    {
+    case PrimitiveType::LineList: return GL_LINES;
+    case PrimitiveType::LineStrip: return GL_LINE_STRIP;
+    case PrimitiveType::PointList: return GL_POINTS;
+    case PrimitiveType::TriangleFan: return GL_TRIANGLE_FAN;
+    case PrimitiveType::TriangleList: return GL_TRIANGLES;
+    case PrimitiveType::TriangleStrip: return GL_TRIANGLE_STRIP;
+    }
+    assert(false);
+    return -1;
+}
+
+inline GLenum VertexBufferDataUsage_to_gl(VertexBufferDataUsage type)
+{
+    switch (type)
+    {
+    case VertexBufferDataUsage::StreamDraw: return GL_STREAM_DRAW;
+    case VertexBufferDataUsage::StaticDraw: return GL_STATIC_DRAW;
+    case VertexBufferDataUsage::DynamicDraw: return GL_DYNAMIC_DRAW;
+    }
+    assert(false);
+    return -1;
+}
+
+struct index_type_glinfo { GLenum type; int32_t size; };
+inline index_type_glinfo IndexType_get_glinfo(IndexType type)
+{
+    switch (type)
+    {
+    case IndexType::UInt8: return index_type_glinfo{ GL_UNSIGNED_BYTE, 1 };
+    case IndexType::UInt16: return index_type_glinfo{ GL_UNSIGNED_SHORT, 2 };
+    case IndexType::UInt32: return index_type_glinfo{ GL_UNSIGNED_INT, 4 };
+    }
+    assert(false);
+    return index_type_glinfo{ (GLenum)-1, 0 };
+}
+
+inline int32_t index_size(GLenum index_type)
+{
+    return index_type == GL_UNSIGNED_INT ? 4 : index_type == GL_UNSIGNED_SHORT ? 2 : 1;
+}
+
+// byte offset of the index 'first' in the element buffer, as the glDrawElements* pointer
+inline const void* index_offset(GLenum index_type, GLint first)
+{
+    return (const void*)((intptr_t)first * index_size(index_type));
+}
+
+inline GLenum ImageFormat_to_gl(ImageFormat format)
+{
+    switch (format)
+    {
+    case ImageFormat::R8: return GL_RED;
+    case ImageFormat::Rg16: return GL_RG;
+    case ImageFormat::Rgb24: return GL_RGB;
+    case ImageFormat::Rgba32: return GL_RGBA;
+    // no pixel transfer format, the blocks are uploaded as they are
+    case ImageFormat::Bc1:
+    case ImageFormat::Bc3:
+    case ImageFormat::Bc4:
+    case ImageFormat::Bc5:
+    case ImageFormat::Bc7: return -1;
+    }
+    assert(false);
+    return -1;
+}
+
+inline bool ImageFormat_is_compressed(ImageFormat format)
+{
+    return format >= ImageFormat::Bc1;
+}
+
+// for immutable storage, which only takes sized internal formats
+inline GLenum ImageFormat_to_gl_sized(ImageFormat format)
+{
+    switch (format)
+    {
+    case ImageFormat::R8: return GL_R8;
+    case ImageFormat::Rg16: return GL_RG8;
+    case ImageFormat::Rgb24: return GL_RGB8;
+    case ImageFormat::Rgba32: return GL_RGBA8;
+    case ImageFormat::Bc1: return GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+    case ImageFormat::Bc3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+    case ImageFormat::Bc4: return GL_COMPRESSED_RED_RGTC1;
+    case ImageFormat::Bc5: return GL_COMPRESSED_RG_RGTC2;
+    case ImageFormat::Bc7: return GL_COMPRESSED_RGBA_BPTC_UNORM_ARB;
+    }
+    assert(false);
+    return -1;
+}
+
+inline int ImageFormat_get_size(ImageFormat format)
+{
+    switch (format)
+    {
+    case ImageFormat::R8: return 1;
+    case ImageFormat::Rg16: return 2;
+    case ImageFormat::Rgb24: return 3;
+    case ImageFormat::Rgba32: return 4;
+    // bytes of a 4x4 block
+    case ImageFormat::Bc1:
+    case ImageFormat::Bc4: return 8;
+    case ImageFormat::Bc3:
+    case ImageFormat::Bc5:
+    case ImageFormat::Bc7: return 16;
+    }
+    assert(false);
+    return -1;
+}
+
+inline int64_t ImageFormat_get_data_size(ImageFormat format, int32_t width, int32_t height)
+{
+    if (ImageFormat_is_compressed(format))
+        return (int64_t)((width + 3) / 4) * ((height + 3) / 4) * ImageFormat_get_size(format);
+    return (int64_t)width * height * ImageFormat_get_size(format);
+}
+
+// rgtc is core, s3tc and bptc are extensions
+inline bool ImageFormat_is_supported(ImageFormat format)
+{
+    switch (format)
+    {
+    case ImageFormat::Bc1:
+    case ImageFormat::Bc3: return GLAD_GL_EXT_texture_compression_s3tc;
+    case ImageFormat::Bc7: return GLAD_GL_ARB_texture_compression_bptc;
+    default: return true;
+    }
+}
+
+inline GLenum TextureFilterType_to_gl(TextureFilterType type)
+{
+    switch (type)
+    {
+    case TextureFilterType::Linear: return GL_LINEAR;
+    case TextureFilterType::Nearest: return GL_NEAREST;
+    case TextureFilterType::LinearMipmapLinear: return GL_LINEAR_MIPMAP_LINEAR;
+    case TextureFilterType::LinearMipmapNearest: return GL_LINEAR_MIPMAP_NEAREST;
+    case TextureFilterType::NearestMipmapLinear: return GL_NEAREST_MIPMAP_LINEAR;
+    case TextureFilterType::NearestMipmapNearest: return GL_NEAREST_MIPMAP_NEAREST;
+    }
+    assert(false);
+    return -1;
+}
+
+// magnification never reads the mip levels, only their base filter is allowed
+inline GLenum TextureFilterType_to_gl_mag(TextureFilterType type)
+{
+    switch (type)
+    {
+    case TextureFilterType::Linear:
+    case TextureFilterType::LinearMipmapLinear:
+    case TextureFilterType::LinearMipmapNearest: return GL_LINEAR;
+    case TextureFilterType::Nearest:
+    case TextureFilterType::NearestMipmapLinear:
+    case TextureFilterType::NearestMipmapNearest: return GL_NEAREST;
+    }
+    assert(false);
+    return -1;
+}
+
+// the mipmap filters leave a texture without mip levels incomplete
+inline bool TextureFilterType_uses_mipmaps(TextureFilterType type)
+{
+    return type != TextureFilterType::Linear && type != TextureFilterType::Nearest;
+}
+
+inline GLenum TextureWrapType_to_gl(TextureWrapType type)
+{
+    switch (type)
+    {
+    case TextureWrapType::ClampToEdge: return GL_CLAMP_TO_EDGE;
+    case TextureWrapType::Repeat: return GL_REPEAT;
+    case TextureWrapType::MirroredRepeat: return GL_MIRRORED_REPEAT;
+    }
+    assert(false);
+    return -1;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,118 @@
+using System.Diagnostics;
+using System.Numerics;
+
+namespace Saladim.Salix.Tests.CommandStreamTest;
+
+// compares one interop call per command against a single command stream submit, press B to run.
+// every item binds a texture, sets a uniform and draws, every few items also upload vertices,
+// the mix a sprite or mesh renderer sends per object
+public class MyGame : Game
+{
+    private static readonly int[] ItemCounts = [1_000, 10_000, 100_000];
+    private const int Iterations = 20;
+    private const int UploadInterval = 16;
+
+    private readonly SpriteBatch batch;
+    private readonly CommandStream stream;
+    private readonly ShaderParameter param;
+    private readonly VertexBuffer<VertexPosition2DColorTexture> quad;
+    private readonly VertexPosition2DColorTexture[] vertices;
+    private readonly Texture2D[] textures;
+    private bool runRequested = true;
+    private string result = "";
+
+    public MyGame()
+    {
+        batch = new(this);
+        stream = new(RenderContext);
+        param = batch.SpriteShader.Shader.GetParameter("trans2d"u8);
+
+        quad = new(RenderContext, VertexPosition2DColorTexture.VertexDeclaration, VertexBufferDataUsage.DynamicDraw);
+        vertices =
+        [
+            new(new(0f, 0f), Color.Known.White, new(0f, 0f)),
+            new(new(4f, 0f), Color.Known.White, new(1f, 0f)),
+            new(new(0f, 4f), Color.Known.White, new(0f, 1f)),
+            new(new(4f, 0f), Color.Known.White, new(1f, 0f)),
+            new(new(0f, 4f), Color.Known.White, new(0f, 1f)),
+            new(new(4f, 4f), Color.Known.White, new(1f, 1f)),
+        ];
+        quad.SetData(vertices);
+
+        // two textures taking turns, so no bind is skipped as redundant
+        ReadOnlySpan<byte> red = [255, 0, 0, 255];
+        ReadOnlySpan<byte> green = [0, 255, 0, 255];
+        textures = [new(RenderContext, 1, 1, red, ImageFormat.Rgba32), new(RenderContext, 1, 1, green, ImageFormat.Rgba32)];
+    }
+
+    public override void Update()
+    {
+        base.Update();
+        if (KeyboardState.IsJustPressed(Key.B))
+            runRequested = true;
+        if (Ticks % 10 == 0)
+            Window.Title = $"Salix.Test.Windows | CommandStreamTest | Fps: {Fps:F2} | {result}";
+    }
+
+    public override void Render()
+    {
+        base.Render();
+        RenderContext.Clear(Color.Known.Black);
+        if (!runRequested) return;
+        runRequested = false;
+
+        batch.SpriteShader.Use();
+        Matrix3x2 projection = Matrix3x2.CreateScale(2f / RenderContext.Viewport.Width, -2f / RenderContext.Viewport.Height)
+            * Matrix3x2.CreateTranslation(-1f, 1f);
+        batch.SpriteShader.SetProjection2D(projection);
+
+        List<string> lines = [];
+        foreach (int count in ItemCounts)
+        {
+            double perCall = Measure(count, PerCall);
+            double streamed = Measure(count, Streamed);
+            lines.Add($"{count}: {perCall:F3}ms / {streamed:F3}ms");
+        }
+        result = string.Join(" | ", lines);
+        Console.WriteLine($"per-call / stream: {result}");
+    }
+
+    private void PerCall(int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (i % UploadInterval == 0)
+                quad.SetData(vertices);
+            RenderContext.SetTexture(0, textures[i & 1]);
+            param.Set(ItemTransform(i));
+            RenderContext.DrawPrimitives(quad, PrimitiveType.TriangleList);
+        }
+    }
+
+    private void Streamed(int count)
+    {
+        for (int i = 0; i < count; i++)
+        {
+            if (i % UploadInterval == 0)
+                stream.SetData(quad, vertices);
+            stream.SetTexture(0, textures[i & 1]);
+            stream.SetParameter(param, ItemTransform(i));
+            stream.DrawPrimitives(quad, PrimitiveType.TriangleList, vertices.Length);
+        }
+        RenderContext.SubmitCommandStream(stream);
+    }
+
+    // spreads the items over a grid so they don't all land on the same pixels
+    private static Matrix3x2 ItemTransform(int i)
+        => Matrix3x2.CreateTranslation(i % 200 * 5f, i / 200 % 120 * 5f);
+
+    // average milliseconds of one run after a warm up run
+    private static double Measure(int count, Action<int> action)
+    {
+        action(count);
+        Stopwatch sw = Stopwatch.StartNew();
+        for (int i = 0; i < Iterations; i++)
+            action(count);
+        return sw.Elapsed.TotalMilliseconds / Iterations;
+    }
+}
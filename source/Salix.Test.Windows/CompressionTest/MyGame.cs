@@ -0,0 +1,110 @@
+using System.Diagnostics;
+using System.Numerics;
+
+namespace Saladim.Salix.Tests.CompressionTest;
+
+// measures ImageCompressor throughput and quality on a generated image, press B to run again
+public class MyGame : Game
+{
+    private static readonly ImageFormat[] Formats = [ImageFormat.Bc1, ImageFormat.Bc3, ImageFormat.Bc7];
+    private static readonly CompressionQuality[] Qualities = [CompressionQuality.Fast, CompressionQuality.High];
+    private const int ImageSize = 1024;
+
+    private readonly SpriteBatch batch;
+    private readonly byte[] pixels;
+    private readonly Texture2D original;
+    private readonly List<Texture2D> compressed = [];
+    private bool runRequested = true;
+    private string result = "";
+
+    public MyGame()
+    {
+        batch = new(this);
+        pixels = GenerateImage(ImageSize);
+        original = new(RenderContext, ImageSize, ImageSize, pixels, ImageFormat.Rgba32);
+    }
+
+    public override void Update()
+    {
+        base.Update();
+        if (KeyboardState.IsJustPressed(Key.B))
+            runRequested = true;
+        if (Ticks % 10 == 0)
+            Window.Title = $"Salix.Test.Windows | CompressionTest | Fps: {Fps:F2} | {result}";
+    }
+
+    public override void Render()
+    {
+        base.Render();
+        RenderContext.Clear(Color.Known.Black);
+        if (runRequested)
+        {
+            runRequested = false;
+            Run();
+        }
+
+        // the original first, then every format in the fast quality, all scaled down to fit a row
+        const float scale = 0.25f;
+        batch.DrawTexture(original, new DrawTransform(Vector2.Zero, Vector2.Zero, new Vector2(scale)));
+        for (int i = 0; i < compressed.Count; i++)
+            batch.DrawTexture(compressed[i], new DrawTransform(new Vector2((i + 1) * ImageSize * scale, 0f), Vector2.Zero, new Vector2(scale)));
+    }
+
+    private void Run()
+    {
+        foreach (var texture in compressed)
+            texture.Dispose();
+        compressed.Clear();
+
+        List<string> lines = [];
+        foreach (ImageFormat format in Formats)
+        {
+            if (!RenderContext.IsFormatSupported(format))
+            {
+                lines.Add($"{format}: unsupported");
+                continue;
+            }
+            byte[] blocks = new byte[ImageCompressor.GetDataSize(format, ImageSize, ImageSize)];
+            foreach (CompressionQuality quality in Qualities)
+            {
+                // warm up, then time a single run
+                ImageCompressor.Compress(pixels, ImageSize, ImageSize, ImageFormat.Rgba32, blocks, format, quality);
+                Stopwatch sw = Stopwatch.StartNew();
+                ImageCompressor.Compress(pixels, ImageSize, ImageSize, ImageFormat.Rgba32, blocks, format, quality);
+                double seconds = sw.Elapsed.TotalSeconds;
+                ImageCompressor.Compress(pixels, ImageSize, ImageSize, ImageFormat.Rgba32, blocks, format, quality, out double psnr);
+
+                double megabytesPerSecond = pixels.Length / seconds / (1024 * 1024);
+                lines.Add($"{format} {quality}: {megabytesPerSecond:F1}MB/s {psnr:F2}dB");
+                if (quality == CompressionQuality.Fast)
+                    compressed.Add(new Texture2D(RenderContext, ImageSize, ImageSize, blocks, format));
+            }
+        }
+        result = string.Join(" | ", lines);
+        Console.WriteLine($"compression: {result}");
+    }
+
+    // smooth gradients, hard edged shapes and a noisy corner, the cases block compression handles differently
+    private static byte[] GenerateImage(int size)
+    {
+        byte[] data = new byte[size * size * 4];
+        Random random = new(1);
+        for (int y = 0; y < size; y++)
+        {
+            for (int x = 0; x < size; x++)
+            {
+                int i = (y * size + x) * 4;
+                float fx = x / (float)size, fy = y / (float)size;
+                data[i] = (byte)(255 * fx);
+                data[i + 1] = (byte)(255 * fy);
+                data[i + 2] = (byte)(127 + 127 * MathF.Sin(x * 0.05f) * MathF.Cos(y * 0.07f));
+                data[i + 3] = (byte)(255 * (1 - fx * fy));
+                if ((x / 32 + y / 32) % 5 == 0)
+                    (data[i], data[i + 1], data[i + 2]) = (240, 40, 90);
+                if (x > size / 2 && y > size / 2)
+                    data[i] = (byte)random.Next(256);
+            }
+        }
+        return data;
+    }
+}
@@ -0,0 +1,60 @@
+using System.Numerics;
+
+namespace Saladim.Salix.Tests.GpuProfilerTest;
+
+// draws a few batches in nested GPU scopes and prints their timings once a second
+public class MyGame : Game
+{
+    private const int SpriteCount = 20000;
+
+    private readonly FileSystemResourceManager res;
+    private readonly SpriteBatch batch;
+    private readonly Texture2D tex;
+
+    public MyGame()
+    {
+        res = new(ResourceLoader);
+        batch = new(this);
+        tex = res.Load<Texture2D>("64x64");
+        RenderContext.GpuProfiler.Enabled = true;
+    }
+
+    public override void Update()
+    {
+        base.Update();
+        GpuProfiler profiler = RenderContext.GpuProfiler;
+        if (Ticks % 10 == 0)
+            Window.Title = $"Salix.Test.Windows | GpuProfilerTest | Fps: {Fps:F2} | Gpu: {profiler.FrameTime.TotalMilliseconds:F3}ms | Dropped: {profiler.DroppedFrames}";
+        if (Ticks % 60 == 0 && profiler.Frame >= 0)
+        {
+            Console.WriteLine($"frame {profiler.Frame}: {profiler.FrameTime.TotalMilliseconds:F3}ms");
+            foreach (GpuScopeTiming scope in profiler.Scopes)
+                Console.WriteLine(scope);
+        }
+    }
+
+    public override void Render()
+    {
+        base.Render();
+        GpuProfiler profiler = RenderContext.GpuProfiler;
+        using (profiler.BeginScope("clear"))
+            RenderContext.Clear(Color.Known.CornflowerBlue);
+
+        using (profiler.BeginScope("sprites"))
+        {
+            for (int pass = 0; pass < 2; pass++)
+            {
+                using (profiler.BeginScope(pass == 0 ? "sprites.back" : "sprites.front"))
+                {
+                    for (int i = 0; i < SpriteCount / 2; i++)
+                    {
+                        float angle = i * 0.01f + Ticks * 0.002f * (pass + 1);
+                        Vector2 position = new(640f + MathF.Cos(angle) * (i % 300), 360f + MathF.Sin(angle) * (i % 300));
+                        batch.DrawTexture(tex, new DrawTransform(position, Vector2.Zero, Vector2.One));
+                    }
+                    batch.Flush();
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,77 @@
+using Microsoft.VisualStudio.TestTools.UnitTesting;
+
+namespace Saladim.Salix.UnitTest;
+
+[TestClass]
+public class VertexDeclarationTests
+{
+    [TestMethod]
+    public void TestWithoutInstanceAttributes()
+    {
+        var decl = new VertexDeclaration(VertexElementType.Vector2, VertexElementType.Color);
+
+        Assert.AreEqual(2, decl.Count);
+        Assert.AreEqual(0, decl.InstanceCount);
+        Assert.AreEqual(VertexElementType.Vector2, decl.Attributes[0]);
+        Assert.AreEqual(VertexElementType.Color, decl.Attributes[1]);
+        Assert.AreEqual(0, decl.InstanceAttributes.Length);
+    }
+
+    [TestMethod]
+    public void TestWithInstanceAttributes()
+    {
+        var decl = new VertexDeclaration(
+            [VertexElementType.Vector2, VertexElementType.Color],
+            [VertexElementType.Vector4, VertexElementType.Single, VertexElementType.Vector2]);
+
+        Assert.AreEqual(2, decl.Count);
+        Assert.AreEqual(3, decl.InstanceCount);
+        Assert.AreEqual(2, decl.Attributes.Length);
+        Assert.AreEqual(VertexElementType.Color, decl.Attributes[1]);
+        Assert.AreEqual(VertexElementType.Vector4, decl.InstanceAttributes[0]);
+        Assert.AreEqual(VertexElementType.Vector2, decl.InstanceAttributes[2]);
+    }
+
+    [TestMethod]
+    public void TestEmptyInstanceAttributes()
+    {
+        var decl1 = new VertexDeclaration(VertexElementType.Vector2, VertexElementType.Color);
+        var decl2 = new VertexDeclaration([VertexElementType.Vector2, VertexElementType.Color], []);
+
+        Assert.IsTrue(decl1 == decl2);
+        Assert.AreEqual(decl1.GetHashCode(), decl2.GetHashCode());
+    }
+
+    [TestMethod]
+    public void TestEquality()
+    {
+        var decl1 = new VertexDeclaration([VertexElementType.Vector2], [VertexElementType.Vector4]);
+        var decl2 = new VertexDeclaration([VertexElementType.Vector2], [VertexElementType.Vector4]);
+
+        Assert.IsTrue(decl1 == decl2);
+        Assert.IsTrue(decl1.Equals((object)decl2));
+        Assert.AreEqual(decl1.GetHashCode(), decl2.GetHashCode());
+    }
+
+    [TestMethod]
+    public void TestInequalityDifferentSplit()
+    {
+        var decl1 = new VertexDeclaration(VertexElementType.Vector2, VertexElementType.Vector4);
+        var decl2 = new VertexDeclaration([VertexElementType.Vector2], [VertexElementType.Vector4]);
+        var decl3 = new VertexDeclaration([], [VertexElementType.Vector2, VertexElementType.Vector4]);
+
+        Assert.IsTrue(decl1 != decl2);
+        Assert.IsTrue(decl2 != decl3);
+        Assert.IsTrue(decl1 != decl3);
+    }
+
+    [TestMethod]
+    public void TestInequality()
+    {
+        var decl1 = new VertexDeclaration([VertexElementType.Vector2], [VertexElementType.Vector4]);
+        var decl2 = new VertexDeclaration([VertexElementType.Vector2], [VertexElementType.Vector3]);
+
+        Assert.IsTrue(decl1 != decl2);
+        Assert.IsTrue(!decl1.Equals(null));
+    }
+}
@@ -1,5 +1,5 @@
-﻿using System.Runtime.CompilerServices;
-
-[assembly: CLSCompliant(true)]
-[assembly: InternalsVisibleTo("Salix.EC")]
+using System.Runtime.CompilerServices;
+
+[assembly: CLSCompliant(true)]
+[assembly: InternalsVisibleTo("Salix.EC")]
 [assembly: InternalsVisibleTo("Salix.UnitTest")]
\ No newline at end of file
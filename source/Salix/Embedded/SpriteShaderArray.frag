@@ -0,0 +1,12 @@
+#version 330 core
+out vec4 FragColor;
+in vec4 vColor;
+in vec2 vTex;
+flat in float vLayer;
+
+uniform sampler2DArray tex;
+
+void main()
+{
+    FragColor = texture(tex, vec3(vTex, vLayer)) * vColor;
+}
\ No newline at end of file
@@ -0,0 +1,26 @@
+#version 330 core
+layout (location = 0) in vec2 aCorner;
+layout (location = 1) in vec2 iPos;
+layout (location = 2) in vec2 iOrigin;
+layout (location = 3) in vec2 iSize;
+layout (location = 4) in float iRadians;
+layout (location = 5) in vec4 iTexRect;
+layout (location = 6) in vec4 iColor;
+out vec4 vColor;
+out vec2 vTex;
+
+uniform mat3x2 trans2d;
+uniform mat3x2 proj2d;
+
+void main()
+{
+    vColor = iColor;
+    vTex = mix(iTexRect.xy, iTexRect.zw, aCorner);
+
+    vec2 local = (aCorner - iOrigin) * iSize;
+    float s = sin(iRadians);
+    float c = cos(iRadians);
+    vec2 pos = vec2(local.x * c - local.y * s, local.x * s + local.y * c) + iPos;
+
+    gl_Position = vec4(proj2d * vec3(trans2d * vec3(pos, 1.0), 1.0), 0.0, 1.0);
+}
\ No newline at end of file
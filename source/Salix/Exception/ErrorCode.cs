@@ -1,30 +1,45 @@
-﻿namespace Saladim.Salix;
-
-// error.h
-public enum ErrorCode : int
-{
-    OK = 0,
-    InvalidParameter = 0x01,
-    NullParameter = 0x02,
-    EnumMappingFailed = 0x03,
-
-    PlatformError = 0x10,
-    GraphicsApiError = 0x11,
-    RegisterWindowFailed = 0x12,
-
-    ContextCreatedTwice = 0x20,
-    ContextGLLoadFailed = 0x21,
-    ContextGLSwapControlNotSupported = 0x22,
-    ContextGLDebugOutputNotSupported = 0x23,
-
-    ContextGLInvalidEnum = 0x24,
-    ContextGLInvalidValue = 0x25,
-    ContextGLInvalidOperation = 0x26,
-    ContextGLInvalidFramebufferOperation = 0x27,
-    ContextGLOutOfMemory = 0x29,
-    ContextGLStackUnderflow = 0x2a,
-    ContextGLStackOverflow = 0x2b,
-    ContextGLUnknownError = 0x2c,
-
-    GLFramebufferNotComplete = 0x30
+namespace Saladim.Salix;
+
+// error.h
+public enum ErrorCode : int
+{
+    OK = 0,
+    InvalidParameter = 0x01,
+    NullParameter = 0x02,
+    EnumMappingFailed = 0x03,
+
+    PlatformError = 0x10,
+    GraphicsApiError = 0x11,
+    RegisterWindowFailed = 0x12,
+
+    ContextCreatedTwice = 0x20,
+    ContextGLLoadFailed = 0x21,
+    ContextGLSwapControlNotSupported = 0x22,
+    ContextGLDebugOutputNotSupported = 0x23,
+
+    ContextGLInvalidEnum = 0x24,
+    ContextGLInvalidValue = 0x25,
+    ContextGLInvalidOperation = 0x26,
+    ContextGLInvalidFramebufferOperation = 0x27,
+    ContextGLOutOfMemory = 0x29,
+    ContextGLStackUnderflow = 0x2a,
+    ContextGLStackOverflow = 0x2b,
+    ContextGLUnknownError = 0x2c,
+
+    GLFramebufferNotComplete = 0x30,
+
+    BundleRecording = 0x40,
+    BundleNotRecording = 0x41,
+
+    CommandStreamInvalid = 0x50,
+    CommandStreamVersionUnsupported = 0x51,
+
+    UniformBindingsExhausted = 0x60,
+
+    ImageContainerInvalid = 0x70,
+    ImageFormatUnsupported = 0x71,
+
+    ShaderCompileFailed = 0x80,
+    ShaderLinkFailed = 0x81,
+    ShaderParamTypeMismatch = 0x82
 }
\ No newline at end of file
@@ -1,32 +1,52 @@
-﻿namespace Saladim.Salix;
-
-internal static class SR
-{
-    public static readonly string KeyNotPresent = "The given key '{0}' was not present in the dictionary.";
-    public static readonly string KeyNotPresentButAlive = "The given key '{0}' was present in the dictionary but it was not alive.";
-    public static readonly string ValueCannotBeNegative = "Value can not be negative.";
-    public static readonly string ValueMustBePositive = "Value must be greater then 0.";
-    public static readonly string FailedToCreateRenderContext = "Failed to create RenderContext.";
-    public static readonly string TypeNotSupportedInShader = "Type of '{0}' is not supported in shader parameter.";
-    public static readonly string PlatformInitializeFailed = "Platform initialize failed.";
-    public static readonly string ResourceTypeNotSupported = "Resource type {0} is not supported.";
-    public static readonly string StreamIsTooLong = "The stream is too long.";
-    public static readonly string InvalidStreamLength = "Invalid stream length.";
-    public static readonly string InvalidImageData = "Invalid image data.";
-    public static readonly string FailedToCreateWindow = "Failed to create window.";
-    public static readonly string TooManyWindowEvents = "Too many window events. (> int.MaxValue)";
-    public static readonly string PreciseTooSmall = "Precise is too small. (less than 3)";
-    public static readonly string PreciseTooBig = "Precise is too big. (greater than 8192)";
-    public static readonly string BufferIsIndexed = "This buffer is indexed.";
-    public static readonly string BufferIsNotIndexed = "This buffer is not indexed.";
-    public static readonly string UnmatchedShaderParamOwner = "Unmatched shader of ShaderParameter.";
-    public static readonly string ImageDataIsNull = "Image data is null.";
-    public static readonly string VerticesDataIsNull = "Vertices or indices data is null";
-    public static readonly string UnknownWindowEventType = "Unknown window event type {0}.";
-    public static readonly string ResourceLoadFailed = "Resource type of {0} load failed. {1}";
-    public static readonly string InvalidWindowSize = "Invalid window size.";
-    public static readonly string FailedToAttachRenderContext = "Failed to attach RenderContext.";
-    public static readonly string ThrowOnOK = "Attempt to throw FrameworkException on ErrorCode OK, if this is not expected please report this bug.";
-    public static readonly string FailedToGetWindowTitle = "Failed to get the title of the window.";
-    public static readonly string ShaderParamNotFound = "Shader parameter '{0}' does not exist.";
+namespace Saladim.Salix;
+
+internal static class SR
+{
+    public static readonly string KeyNotPresent = "The given key '{0}' was not present in the dictionary.";
+    public static readonly string KeyNotPresentButAlive = "The given key '{0}' was present in the dictionary but it was not alive.";
+    public static readonly string ValueCannotBeNegative = "Value can not be negative.";
+    public static readonly string ValueMustBePositive = "Value must be greater then 0.";
+    public static readonly string FailedToCreateRenderContext = "Failed to create RenderContext.";
+    public static readonly string TypeNotSupportedInShader = "Type of '{0}' is not supported in shader parameter.";
+    public static readonly string PlatformInitializeFailed = "Platform initialize failed.";
+    public static readonly string ResourceTypeNotSupported = "Resource type {0} is not supported.";
+    public static readonly string StreamIsTooLong = "The stream is too long.";
+    public static readonly string InvalidStreamLength = "Invalid stream length.";
+    public static readonly string InvalidImageData = "Invalid image data.";
+    public static readonly string FailedToCreateWindow = "Failed to create window.";
+    public static readonly string TooManyWindowEvents = "Too many window events. (> int.MaxValue)";
+    public static readonly string PreciseTooSmall = "Precise is too small. (less than 3)";
+    public static readonly string PreciseTooBig = "Precise is too big. (greater than 8192)";
+    public static readonly string BufferIsIndexed = "This buffer is indexed.";
+    public static readonly string BufferIsNotIndexed = "This buffer is not indexed.";
+    public static readonly string DrawRangeOutOfBounds = "The draw range is outside of the buffer data.";
+    public static readonly string BundleAlreadyRecording = "A command bundle is already being recorded.";
+    public static readonly string BundleNotRecording = "No command bundle is being recorded.";
+    public static readonly string UniformBufferRangeOutOfBounds = "The data range is outside of the uniform buffer.";
+    public static readonly string VertexBufferRangeOutOfBounds = "The data range is outside of the vertex buffer.";
+    public static readonly string IndexTypeMismatch = "The index type does not match the index data of the buffer.";
+    public static readonly string UniformDataIsNull = "Uniform data is null.";
+    public static readonly string VertexDeclarationHasNoInstanceAttributes = "The vertex declaration of this buffer has no instance attributes.";
+    public static readonly string UnmatchedShaderParamOwner = "Unmatched shader of ShaderParameter.";
+    public static readonly string ImageDataIsNull = "Image data is null.";
+    public static readonly string MipmapFilterNotSupported = "Mipmap filters are not supported, this texture has no mip levels.";
+    public static readonly string VerticesDataIsNull = "Vertices or indices data is null";
+    public static readonly string UnknownWindowEventType = "Unknown window event type {0}.";
+    public static readonly string ResourceLoadFailed = "Resource type of {0} load failed. {1}";
+    public static readonly string InvalidWindowSize = "Invalid window size.";
+    public static readonly string FailedToAttachRenderContext = "Failed to attach RenderContext.";
+    public static readonly string ThrowOnOK = "Attempt to throw FrameworkException on ErrorCode OK, if this is not expected please report this bug.";
+    public static readonly string FailedToGetWindowTitle = "Failed to get the title of the window.";
+    public static readonly string GLErrorReported = "A GL error was found by the {0} error policy at {1}.";
+    public static readonly string UnknownGLErrorSite = "an unknown call site";
+    public static readonly string TextureIsAtlased = "The texture shares an atlas page, its data and sampling state can't be changed.";
+    public static readonly string AtlasTextureSizeTooBig = "The max texture size of an atlas must leave room for the padding in a page.";
+    public static readonly string TextureRegionOutOfBounds = "The region is outside of the texture or its data.";
+    public static readonly string TextureIsImmutable = "The texture has immutable storage, its size and format can't change.";
+    public static readonly string TextureHasNoMipStorage = "Mip levels can only be set on a texture created with immutable storage.";
+    public static readonly string ImageFormatNotSupported = "The image format {0} is not supported by the graphics driver.";
+    public static readonly string ImageFormatIsCompressed = "The operation needs uncompressed pixels, {0} is block compressed.";
+    public static readonly string TextureTooBigForAtlas = "The texture is larger than the max texture size of the atlas.";
+    public static readonly string ShaderBuildFailed = "The shader failed to build:\n{0}";
+    public static readonly string ShaderParamNotFound = "Shader parameter '{0}' does not exist.";
 }
\ No newline at end of file
@@ -1 +1 @@
-﻿global using ByteArrayPool = System.Buffers.ArrayPool<byte>;
\ No newline at end of file
+global using ByteArrayPool = System.Buffers.ArrayPool<byte>;
\ No newline at end of file
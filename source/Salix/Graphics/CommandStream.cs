@@ -0,0 +1,302 @@
+using System.Drawing;
+using System.Numerics;
+using System.Runtime.CompilerServices;
+using System.Runtime.InteropServices;
+
+namespace Saladim.Salix;
+
+/// <summary>
+/// A packed binary stream of render commands, decoded natively by
+/// <see cref="RenderContext.SubmitCommandStream(CommandStream)"/> in a single interop call.
+/// </summary>
+/// <remarks>
+/// Resources are only referenced, so they must stay alive until the stream is submitted.
+/// Counts are not validated until submitting.
+/// </remarks>
+public sealed class CommandStream
+{
+    // api_command_stream.h
+    private const uint Magic = 0x43584c53;
+    private const ushort Version = 3;
+
+    private enum Op : uint
+    {
+        Viewport,
+        Clear,
+        SetShader,
+        SetTexture,
+        SetSampler,
+        UniformInt,
+        UniformFloat,
+        UniformVec4,
+        UniformMat4,
+        UniformMat3x2,
+        UploadVertices,
+        UploadIndices,
+        UploadInstances,
+        Draw,
+        DrawIndexed,
+        DrawData
+    }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct Bind { public ulong handle; public int index; public int reserved; }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct Uniform { public ulong shader; public int location; public int reserved; }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct Upload { public ulong buffer; public VertexBufferDataUsage usage; public int size; }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct UploadIndices { public ulong buffer; public VertexBufferDataUsage usage; public int size; public IndexType indexType; public int reserved; }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct Draw { public ulong buffer; public PrimitiveType primitive; public int count; public int instances; public int first; public int baseVertex; public int reserved; }
+
+    [StructLayout(LayoutKind.Sequential)]
+    private struct DrawData { public ulong vertexType; public PrimitiveType primitive; public int vertices; public int size; public int reserved; }
+
+    private const int HeaderSize = 8;
+    private const int CommandHeaderSize = 8;
+
+    private readonly RenderContext context;
+    private byte[] buffer;
+    private int length;
+    private int commandsCount;
+    private int drawCalls;
+    private bool shaderSet;
+    private Shader? lastShader;
+    private Rectangle? lastViewport;
+
+    public RenderContext RenderContext => context;
+
+    /// <summary>Size in bytes of the stream written so far.</summary>
+    public int Length => length;
+    public int CommandsCount => commandsCount;
+    internal int DrawCalls => drawCalls;
+    internal bool ShaderSet => shaderSet;
+    internal Shader? LastShader => lastShader;
+    internal Rectangle? LastViewport => lastViewport;
+
+    public CommandStream(RenderContext context, int capacity = 4096)
+    {
+        ThrowHelper.ThrowIfNull(context);
+        if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity), SR.ValueMustBePositive);
+        this.context = context;
+        buffer = new byte[Math.Max(capacity, HeaderSize)];
+        Reset();
+    }
+
+    /// <summary>Remove all the written commands.</summary>
+    public void Reset()
+    {
+        Unsafe.WriteUnaligned(ref buffer[0], Magic);
+        Unsafe.WriteUnaligned(ref buffer[4], Version);
+        Unsafe.WriteUnaligned(ref buffer[6], (ushort)0);
+        length = HeaderSize;
+        commandsCount = 0;
+        drawCalls = 0;
+        shaderSet = false;
+        lastShader = null;
+        lastViewport = null;
+    }
+
+    public void Viewport(Rectangle viewport)
+    {
+        int at = Reserve(Op.Viewport, 16, 0);
+        Unsafe.WriteUnaligned(ref buffer[at], viewport.X);
+        Unsafe.WriteUnaligned(ref buffer[at + 4], viewport.Y);
+        Unsafe.WriteUnaligned(ref buffer[at + 8], viewport.Width);
+        Unsafe.WriteUnaligned(ref buffer[at + 12], viewport.Height);
+        lastViewport = viewport;
+    }
+
+    public void Clear(Color color)
+    {
+        int at = Reserve(Op.Clear, 16, 0);
+        Unsafe.WriteUnaligned(ref buffer[at], color.R);
+        Unsafe.WriteUnaligned(ref buffer[at + 4], color.G);
+        Unsafe.WriteUnaligned(ref buffer[at + 8], color.B);
+        Unsafe.WriteUnaligned(ref buffer[at + 12], color.A);
+    }
+
+    public void SetShader(Shader? shader)
+    {
+        WriteBind(Op.SetShader, shader?.NativeHandle ?? IntPtr.Zero, 0);
+        shaderSet = true;
+        lastShader = shader;
+    }
+
+    public void SetTexture(int index, Texture2D texture)
+    {
+        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
+        ThrowHelper.ThrowIfNull(texture);
+        WriteBind(Op.SetTexture, texture.NativeHandle, index);
+    }
+
+    public void SetSampler(int index, Sampler sampler)
+    {
+        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
+        ThrowHelper.ThrowIfNull(sampler);
+        WriteBind(Op.SetSampler, sampler.NativeHandle, index);
+    }
+
+    /// <summary>Set a shader parameter, supports the same types as <see cref="Shader.SetParameter{T}(ShaderParameter, ref T)"/>.</summary>
+    public void SetParameter<T>(ShaderParameter param, T value) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(param.Shader);
+        Op op;
+        if (typeof(T) == typeof(int) || typeof(T) == typeof(bool)) op = Op.UniformInt;
+        else if (typeof(T) == typeof(float)) op = Op.UniformFloat;
+        else if (typeof(T) == typeof(Vector4)) op = Op.UniformVec4;
+        else if (typeof(T) == typeof(Matrix3x2)) op = Op.UniformMat3x2;
+        else if (typeof(T) == typeof(Matrix4x4)) op = Op.UniformMat4;
+        else throw new NotSupportedException(string.Format(SR.TypeNotSupportedInShader, typeof(T)));
+
+        int valueSize = typeof(T) == typeof(bool) ? 4 : Unsafe.SizeOf<T>();
+        int at = Reserve(op, Unsafe.SizeOf<Uniform>(), valueSize);
+        Uniform cmd = new() { shader = ToHandle(param.Shader.NativeHandle), location = param.Location };
+        Unsafe.WriteUnaligned(ref buffer[at], cmd);
+        at += Unsafe.SizeOf<Uniform>();
+        if (typeof(T) == typeof(bool))
+            Unsafe.WriteUnaligned(ref buffer[at], Unsafe.As<T, bool>(ref value) ? 1 : 0);
+        else
+            Unsafe.WriteUnaligned(ref buffer[at], value);
+    }
+
+    public void SetData<T>(VertexBuffer<T> vertexBuffer, ReadOnlySpan<T> data) where T : unmanaged
+        => WriteUpload(Op.UploadVertices, vertexBuffer, MemoryMarshal.AsBytes(data));
+
+    public void SetIndexData<T>(VertexBuffer<T> vertexBuffer, ReadOnlySpan<byte> data) where T : unmanaged
+        => WriteUploadIndices(vertexBuffer, data, IndexType.UInt8);
+
+    [CLSCompliant(false)]
+    public void SetIndexData<T>(VertexBuffer<T> vertexBuffer, ReadOnlySpan<ushort> data) where T : unmanaged
+        => WriteUploadIndices(vertexBuffer, MemoryMarshal.AsBytes(data), IndexType.UInt16);
+
+    [CLSCompliant(false)]
+    public void SetIndexData<T>(VertexBuffer<T> vertexBuffer, ReadOnlySpan<uint> data) where T : unmanaged
+        => WriteUploadIndices(vertexBuffer, MemoryMarshal.AsBytes(data), IndexType.UInt32);
+
+    public void SetInstanceData<T, TInstance>(VertexBuffer<T> vertexBuffer, ReadOnlySpan<TInstance> data)
+        where T : unmanaged
+        where TInstance : unmanaged
+        => WriteUpload(Op.UploadInstances, vertexBuffer, MemoryMarshal.AsBytes(data));
+
+    /// <param name="instanceCount">0 for a non instanced draw.</param>
+    public void DrawPrimitives<T>(VertexBuffer<T> vertexBuffer, PrimitiveType primitiveType, int verticesCount, int instanceCount = 0)
+        where T : unmanaged
+        => WriteDraw(Op.Draw, vertexBuffer, primitiveType, 0, verticesCount, 0, instanceCount);
+
+    /// <summary>Draw <paramref name="verticesCount"/> vertices starting at <paramref name="first"/>.</summary>
+    /// <param name="instanceCount">0 for a non instanced draw.</param>
+    public void DrawPrimitives<T>(VertexBuffer<T> vertexBuffer, PrimitiveType primitiveType, int first, int verticesCount, int instanceCount)
+        where T : unmanaged
+        => WriteDraw(Op.Draw, vertexBuffer, primitiveType, first, verticesCount, 0, instanceCount);
+
+    /// <param name="instanceCount">0 for a non instanced draw.</param>
+    public void DrawIndexedPrimitives<T>(VertexBuffer<T> vertexBuffer, PrimitiveType primitiveType, int indicesCount, int instanceCount = 0)
+        where T : unmanaged
+        => WriteDraw(Op.DrawIndexed, vertexBuffer, primitiveType, 0, indicesCount, 0, instanceCount);
+
+    /// <summary>Draw <paramref name="indicesCount"/> indices starting at <paramref name="firstIndex"/>, each offset by <paramref name="baseVertex"/>.</summary>
+    /// <param name="instanceCount">0 for a non instanced draw.</param>
+    public void DrawIndexedPrimitives<T>(VertexBuffer<T> vertexBuffer, PrimitiveType primitiveType, int firstIndex, int indicesCount, int baseVertex, int instanceCount = 0)
+        where T : unmanaged
+        => WriteDraw(Op.DrawIndexed, vertexBuffer, primitiveType, firstIndex, indicesCount, baseVertex, instanceCount);
+
+    /// <summary>Draw <paramref name="vertices"/> copied into the stream.</summary>
+    public void DrawPrimitives<T>(VertexDeclaration vertexDeclaration, PrimitiveType primitiveType, ReadOnlySpan<T> vertices)
+        where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(vertexDeclaration);
+        ThrowHelper.ThrowIfInvalid(vertices.IsEmpty, SR.VerticesDataIsNull);
+        ReadOnlySpan<byte> bytes = MemoryMarshal.AsBytes(vertices);
+        int at = Reserve(Op.DrawData, Unsafe.SizeOf<DrawData>(), bytes.Length);
+        DrawData cmd = new()
+        {
+            vertexType = ToHandle(context.SafeGetVertexType(vertexDeclaration)),
+            primitive = primitiveType,
+            vertices = vertices.Length,
+            size = bytes.Length
+        };
+        Unsafe.WriteUnaligned(ref buffer[at], cmd);
+        bytes.CopyTo(buffer.AsSpan(at + Unsafe.SizeOf<DrawData>()));
+        drawCalls++;
+    }
+
+    internal ReadOnlySpan<byte> AsSpan() => new(buffer, 0, length);
+
+    private void WriteBind(Op op, IntPtr handle, int index)
+    {
+        int at = Reserve(op, Unsafe.SizeOf<Bind>(), 0);
+        Unsafe.WriteUnaligned(ref buffer[at], new Bind() { handle = ToHandle(handle), index = index });
+    }
+
+    private void WriteUpload<T>(Op op, VertexBuffer<T> vertexBuffer, ReadOnlySpan<byte> data) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(vertexBuffer);
+        ThrowHelper.ThrowIfInvalid(data.IsEmpty, SR.VerticesDataIsNull);
+        int at = Reserve(op, Unsafe.SizeOf<Upload>(), data.Length);
+        Upload cmd = new() { buffer = ToHandle(vertexBuffer.NativeHandle), usage = vertexBuffer.DataUsage, size = data.Length };
+        Unsafe.WriteUnaligned(ref buffer[at], cmd);
+        data.CopyTo(buffer.AsSpan(at + Unsafe.SizeOf<Upload>()));
+    }
+
+    private void WriteUploadIndices<T>(VertexBuffer<T> vertexBuffer, ReadOnlySpan<byte> data, IndexType indexType) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(vertexBuffer);
+        ThrowHelper.ThrowIfInvalid(data.IsEmpty, SR.VerticesDataIsNull);
+        int at = Reserve(Op.UploadIndices, Unsafe.SizeOf<UploadIndices>(), data.Length);
+        UploadIndices cmd = new()
+        {
+            buffer = ToHandle(vertexBuffer.NativeHandle),
+            usage = vertexBuffer.DataUsage,
+            size = data.Length,
+            indexType = indexType
+        };
+        Unsafe.WriteUnaligned(ref buffer[at], cmd);
+        data.CopyTo(buffer.AsSpan(at + Unsafe.SizeOf<UploadIndices>()));
+    }
+
+    private void WriteDraw<T>(Op op, VertexBuffer<T> vertexBuffer, PrimitiveType primitiveType, int first, int count, int baseVertex, int instanceCount)
+        where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(vertexBuffer);
+        if (first < 0) throw new ArgumentOutOfRangeException(nameof(first), SR.ValueCannotBeNegative);
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count), SR.ValueMustBePositive);
+        if (instanceCount < 0) throw new ArgumentOutOfRangeException(nameof(instanceCount), SR.ValueCannotBeNegative);
+        int at = Reserve(op, Unsafe.SizeOf<Draw>(), 0);
+        Draw cmd = new()
+        {
+            buffer = ToHandle(vertexBuffer.NativeHandle),
+            primitive = primitiveType,
+            count = count,
+            instances = instanceCount,
+            first = first,
+            baseVertex = baseVertex
+        };
+        Unsafe.WriteUnaligned(ref buffer[at], cmd);
+        drawCalls++;
+    }
+
+    // writes the command header and returns the offset of the payload
+    private int Reserve(Op op, int fixedSize, int extraSize)
+    {
+        int payloadSize = checked(fixedSize + extraSize + 7) & ~7;
+        int required = checked(length + CommandHeaderSize + payloadSize);
+        if (required > buffer.Length)
+            Array.Resize(ref buffer, Math.Max(required, buffer.Length * 2));
+
+        Unsafe.WriteUnaligned(ref buffer[length], (uint)op);
+        Unsafe.WriteUnaligned(ref buffer[length + 4], (uint)payloadSize);
+        int at = length + CommandHeaderSize;
+        length = required;
+        commandsCount++;
+        return at;
+    }
+
+    private static ulong ToHandle(IntPtr handle)
+        => (ulong)handle.ToInt64();
+}
@@ -0,0 +1,11 @@
+namespace Saladim.Salix;
+
+/// <summary>How hard <see cref="ImageCompressor"/> searches for the block endpoints.</summary>
+public enum CompressionQuality
+{
+    /// <summary>One projection per block, meant for compressing while loading.</summary>
+    Fast,
+
+    /// <summary>Exact index search with refined endpoints, several times slower, meant for asset builds.</summary>
+    High
+}
@@ -0,0 +1,67 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// What the native layer did over a frame, counted since the stats were last reset by
+/// <see cref="RenderContext.GetFrameStats(bool)"/>.
+/// </summary>
+public readonly struct FrameStats
+{
+    private readonly Interop.FrameStats stats;
+
+    public long DrawCalls => stats.draws;
+
+    /// <summary>Vertices of the non-indexed draws, times their instance count.</summary>
+    public long Vertices => stats.vertices;
+
+    /// <summary>Indices of the indexed draws, times their instance count.</summary>
+    public long Indices => stats.indices;
+
+    /// <summary>Bytes copied into vertex, index, instance and uniform buffers, streamed vertices included.</summary>
+    public long BufferBytesUploaded => stats.bufferBytes;
+
+    public long TextureBytesUploaded => stats.textureBytes;
+
+    /// <summary>Texture and texture unit binds.</summary>
+    public BindCounts TextureBinds => new(stats.textureBinds);
+
+    public BindCounts ShaderBinds => new(stats.shaderBinds);
+
+    public BindCounts VertexArrayBinds => new(stats.vaoBinds);
+
+    public BindCounts FramebufferBinds => new(stats.fboBinds);
+
+    /// <summary>Buffer, sampler, blend state and viewport changes.</summary>
+    public BindCounts OtherBinds => new(stats.otherBinds);
+
+    public long UniformUploads => stats.uniforms.uploaded;
+
+    /// <summary>Shader parameter uploads skipped as the program already held the same value.</summary>
+    public long UniformUploadsSkipped => stats.uniforms.skipped;
+
+    /// <summary>glGetError calls made, which depends on the <see cref="GLErrorPolicy"/>.</summary>
+    public long GLErrorChecks => stats.glErrorChecks;
+
+    /// <summary>Native graphics calls, calls made by other native calls aren't counted.</summary>
+    public long NativeCalls => stats.apiCalls;
+
+    /// <summary>Time spent inside the native graphics calls.</summary>
+    public TimeSpan NativeTime => TimeSpan.FromTicks(stats.apiNanoseconds / 100);
+
+    internal FrameStats(in Interop.FrameStats stats)
+        => this.stats = stats;
+}
+
+public readonly struct BindCounts
+{
+    /// <summary>GL calls made.</summary>
+    public long Issued { get; }
+
+    /// <summary>GL calls avoided as the native state shadow already matched.</summary>
+    public long Skipped { get; }
+
+    internal BindCounts(Interop.BindStats stats)
+        => (Issued, Skipped) = (stats.issued, stats.skipped);
+
+    public override string ToString()
+        => $"{Issued} issued, {Skipped} skipped";
+}
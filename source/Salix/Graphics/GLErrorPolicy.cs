@@ -0,0 +1,17 @@
+namespace Saladim.Salix;
+
+/// <summary>How the OpenGL errors are looked for, chosen when the <see cref="RenderContext"/> is created.</summary>
+public enum GLErrorPolicy
+{
+    /// <summary>glGetError after every GL call, the failing method throws. Slowest, as each check may stall the driver.</summary>
+    PerCall,
+
+    /// <summary>
+    /// glGetError once a frame at swap time. After a frame with an error the next frame is checked per call
+    /// to find the first failing call site, then the error is thrown at the end of that frame.
+    /// </summary>
+    PerFrame,
+
+    /// <summary>No polling, errors are collected by the ARB_debug_output callback and thrown at swap time.</summary>
+    DebugCallback
+}
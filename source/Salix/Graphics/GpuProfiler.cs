@@ -0,0 +1,129 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// Times named scopes of GPU work with timestamp queries. A frame's results are read back a few frames
+/// after it was submitted, so reading them never waits for the GPU.
+/// </summary>
+public sealed class GpuProfiler
+{
+    private readonly RenderContext context;
+    private readonly Dictionary<string, int> nameIds = new();
+    private readonly List<string> names = new();
+    private readonly List<GpuScopeTiming> scopes = new();
+    private Interop.GpuScopeResult[] results = new Interop.GpuScopeResult[64];
+    private Interop.GpuFrameInfo info = new() { frame = -1 };
+    private bool enabled;
+
+    /// <summary>Whether scopes are timed, off by default as every scope costs two queries.</summary>
+    public bool Enabled
+    {
+        get => enabled;
+        set
+        {
+            if (enabled == value) return;
+            if (Interop.SLX_SetGpuProfiling(value))
+                Interop.Throw();
+            enabled = value;
+        }
+    }
+
+    /// <summary>Index of the frame the results are from, -1 before the first one was read back.</summary>
+    public long Frame { get { Refresh(); return info.frame; } }
+
+    /// <summary>GPU time between the first and last command of the frame.</summary>
+    public TimeSpan FrameTime { get { Refresh(); return FromNanoseconds(info.duration); } }
+
+    /// <summary>The timed scopes of the frame in the order they began.</summary>
+    public IReadOnlyList<GpuScopeTiming> Scopes { get { Refresh(); return scopes; } }
+
+    /// <summary>Frames whose results weren't ready when their queries were reused, the GPU was too far behind.</summary>
+    public int DroppedFrames { get { Refresh(); return info.droppedFrames; } }
+
+    internal GpuProfiler(RenderContext context)
+        => this.context = context;
+
+    /// <summary>Begin a scope, which can nest in others. Disposing the returned value ends it.</summary>
+    public GpuScope BeginScope(string name)
+    {
+        ThrowHelper.ThrowIfNull(name);
+        if (!nameIds.TryGetValue(name, out int id))
+        {
+            id = names.Count;
+            names.Add(name);
+            nameIds.Add(name, id);
+        }
+        if (Interop.SLX_GpuScopeBegin(id))
+            Interop.Throw();
+        return new GpuScope(this);
+    }
+
+    public void EndScope()
+    {
+        if (Interop.SLX_GpuScopeEnd())
+            Interop.Throw();
+    }
+
+    private unsafe void Refresh()
+    {
+        _ = context.NativeHandle;
+        Interop.GpuFrameInfo latest;
+        fixed (Interop.GpuScopeResult* ptr = results)
+        {
+            if (Interop.SLX_GetGpuFrameResults(out latest, ptr, results.Length))
+                Interop.Throw();
+        }
+        if (latest.frame == info.frame)
+            return;
+        if (latest.scopeCount > results.Length)
+        {
+            results = new Interop.GpuScopeResult[latest.scopeCount];
+            fixed (Interop.GpuScopeResult* ptr = results)
+            {
+                if (Interop.SLX_GetGpuFrameResults(out latest, ptr, results.Length))
+                    Interop.Throw();
+            }
+        }
+
+        info = latest;
+        scopes.Clear();
+        for (int i = 0; i < info.scopeCount; i++)
+        {
+            ref Interop.GpuScopeResult r = ref results[i];
+            scopes.Add(new GpuScopeTiming(names[r.name], r.depth, FromNanoseconds(r.begin), FromNanoseconds(r.duration)));
+        }
+    }
+
+    private static TimeSpan FromNanoseconds(long nanoseconds)
+        => TimeSpan.FromTicks(nanoseconds / 100);
+}
+
+/// <summary>An open <see cref="GpuProfiler"/> scope, for <see langword="using"/>.</summary>
+public readonly struct GpuScope : IDisposable
+{
+    private readonly GpuProfiler profiler;
+
+    internal GpuScope(GpuProfiler profiler)
+        => this.profiler = profiler;
+
+    public void Dispose()
+        => profiler.EndScope();
+}
+
+public readonly struct GpuScopeTiming
+{
+    public string Name { get; }
+
+    /// <summary>How many scopes this one is nested in.</summary>
+    public int Depth { get; }
+
+    /// <summary>GPU time from the start of the frame.</summary>
+    public TimeSpan Begin { get; }
+
+    public TimeSpan Duration { get; }
+
+    internal GpuScopeTiming(string name, int depth, TimeSpan begin, TimeSpan duration)
+        => (Name, Depth, Begin, Duration) = (name, depth, begin, duration);
+
+    public override string ToString()
+        => $"{new string(' ', Depth * 2)}{Name}: {Duration.TotalMilliseconds:F3}ms";
+}
@@ -1,10 +1,10 @@
-﻿namespace Saladim.Salix;
-
-public enum GraphicsBackend
-{
-    Unknown,
-    OpenGL33,
-    DirectX11,
-}
-
+namespace Saladim.Salix;
+
+public enum GraphicsBackend
+{
+    Unknown,
+    OpenGL33,
+    DirectX11,
+}
+
 // at least I'm going to impl the opengl 3.3 and directX11 backend
\ No newline at end of file
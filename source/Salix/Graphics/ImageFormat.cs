@@ -1,9 +1,20 @@
-﻿namespace Saladim.Salix;
-
-public enum ImageFormat
-{
-    R8,
-    Rg16,
-    Rgb24,
-    Rgba32
+namespace Saladim.Salix;
+
+public enum ImageFormat
+{
+    R8,
+    Rg16,
+    Rgb24,
+    Rgba32,
+
+    /// <summary>S3TC/DXT1, 4x4 blocks of 8 bytes, RGB with 1 bit alpha.</summary>
+    Bc1,
+    /// <summary>S3TC/DXT5, 4x4 blocks of 16 bytes, RGBA.</summary>
+    Bc3,
+    /// <summary>RGTC1, 4x4 blocks of 8 bytes, single channel.</summary>
+    Bc4,
+    /// <summary>RGTC2, 4x4 blocks of 16 bytes, two channels.</summary>
+    Bc5,
+    /// <summary>BPTC, 4x4 blocks of 16 bytes, high quality RGBA.</summary>
+    Bc7
 };
\ No newline at end of file
@@ -1,244 +1,727 @@
-﻿using System.Drawing;
-
-namespace Saladim.Salix;
-
-// TODO dispose impl
-public sealed class RenderContext
-{
-    private readonly Dictionary<VertexDeclaration, IntPtr> vertexDeclarations;
-    private readonly List<Action> queuedActions;
-    private readonly int creationThreadId;
-    private readonly IntPtr nativeHandle;
-    private readonly double vSyncFrameTime = 0d;
-    private Shader? currentShader;
-    private RenderTarget? currentRenderTarget = null;
-    private Rectangle viewport;
-    private bool vSyncEnabled = false;
-
-    private long totalDrawCalls;
-    private Size windowSize;
-
-    internal IntPtr NativeHandle => nativeHandle;
-
-    public long TotalDrawCalls => totalDrawCalls;
-
-    public Rectangle Viewport
-    {
-        get { EnsureState(); return viewport; }
-        set
-        {
-            EnsureState();
-            PreviewStateChanged?.Invoke(RenderContextState.Viewport);
-            if (Interop.SLX_Viewport(value.X, value.Y, value.Width, value.Height))
-                Interop.Throw();
-            viewport = value;
-            StateChanged?.Invoke(RenderContextState.Viewport);
-        }
-    }
-
-    /// <summary>Indicates is this <see cref="RenderContext"/> enabled the Vertical Synchronization.</summary>
-    public bool VSyncEnabled
-    {
-        get { EnsureState(); return vSyncEnabled; }
-        set { EnsureState(); Interop.SLX_SetVSyncEnabled(value); vSyncEnabled = value; }
-    }
-
-    /// <summary>The frame time will be when the <see cref="VSyncEnabled"/> is true.</summary>
-    public double VSyncFrameTime
-    {
-        get { EnsureState(); return vSyncFrameTime; }
-    }
-
-    public RenderTarget? RenderTarget
-    {
-        get { EnsureState(); return currentRenderTarget; }
-        set
-        {
-            if (currentRenderTarget == value) return;
-            PreviewStateChanged?.Invoke(RenderContextState.RenderTarget);
-            if (value is null)
-            {
-                if (Interop.SLX_SetRenderTarget(IntPtr.Zero))
-                    Interop.Throw();
-                Viewport = new(0, 0, windowSize.Width, windowSize.Height);
-            }
-            else
-            {
-                if (Interop.SLX_SetRenderTarget(value.NativeHandle))
-                    Interop.Throw();
-                Viewport = new(0, 0, value.Width, value.Height);
-            }
-            currentRenderTarget = value;
-            StateChanged?.Invoke(RenderContextState.RenderTarget);
-        }
-    }
-
-    public Shader? Shader
-    {
-        get { EnsureState(); return currentShader; }
-        set
-        {
-            if (currentShader == value) return;
-            PreviewStateChanged?.Invoke(RenderContextState.Shader);
-            bool result = value is not null ?
-                Interop.SLX_SetShader(value.NativeHandle) :
-                Interop.SLX_SetShader(IntPtr.Zero);
-            if (result) Interop.Throw();
-            currentShader = value;
-            StateChanged?.Invoke(RenderContextState.Shader);
-        }
-    }
-
-    public event Action<RenderContextState>? StateChanged;
-    public event Action<RenderContextState>? PreviewStateChanged;
-
-    public RenderContext()
-    {
-        vertexDeclarations = new();
-        queuedActions = new(8);
-        creationThreadId = Environment.CurrentManagedThreadId;
-        vSyncFrameTime = Interop.SLX_GetVSyncFrameTime();
-        var rc = Interop.SLX_CreateRenderContext();
-        if (rc == IntPtr.Zero)
-            throw new FrameworkException(SR.FailedToCreateRenderContext, Interop.SLX_GetError());
-        nativeHandle = rc;
-    }
-
-    internal void ProcessQueuedActions()
-    {
-        lock (queuedActions)
-        {
-            foreach (var item in queuedActions)
-                item();
-            queuedActions.Clear();
-        }
-    }
-
-    internal void OnWindowResized(Window _, int width, int height)
-    {
-        windowSize = new(width, height);
-        if (RenderTarget is null)
-            Viewport = new(0, 0, width, height);
-    }
-
-    internal void AttachToWindow(Window window)
-    {
-        if (Interop.SLX_AttachRenderContext(window.NativeHandle, NativeHandle))
-            throw new FrameworkException(SR.FailedToAttachRenderContext, Interop.SLX_GetError());
-        window.Resized += OnWindowResized;
-    }
-
-    /// <summary>Invoke an action on the RenderContext creation thread.</summary>
-    public void Invoke(Action action)
-    {
-        if (Environment.CurrentManagedThreadId != creationThreadId)
-            lock (queuedActions)
-                queuedActions.Add(action);
-        else
-            action();
-    }
-
-    /// <summary>Clear this RenderContext in a color.</summary>
-    public void Clear(Color color)
-    {
-        EnsureState();
-        if (Interop.SLX_Clear(color.R, color.G, color.B, color.A))
-            Interop.Throw();
-    }
-
-    internal unsafe IntPtr SafeGetVertexType(VertexDeclaration vertexDeclaration)
-    {
-        EnsureState();
-        ThrowHelper.ThrowIfNull(vertexDeclaration);
-        if (!vertexDeclarations.TryGetValue(vertexDeclaration, out IntPtr vertexType))
-        {
-            fixed (VertexElementType* ptr = vertexDeclaration.Attributes)
-            {
-                vertexType = Interop.SLX_RegisterVertexType(ptr, vertexDeclaration.Count);
-                if (vertexType == IntPtr.Zero) Interop.Throw();
-                vertexDeclarations.Add(vertexDeclaration, vertexType);
-            }
-        }
-        return vertexType;
-    }
-
-    /// <summary>Draw primitives with <typeparamref name="T"/>* on this RenderContext.</summary>
-    public unsafe void DrawPrimitives<T>(
-        VertexDeclaration vertexDeclaration,
-        PrimitiveType primitiveType,
-        ReadOnlySpan<T> vertices
-        ) where T : unmanaged
-    {
-        EnsureState();
-        ThrowHelper.ThrowIfNull(vertexDeclaration);
-        totalDrawCalls++;
-
-        IntPtr vertexType = SafeGetVertexType(vertexDeclaration);
-        fixed (T* vptr = vertices)
-        {
-            bool result = Interop.SLX_DrawPrimitives(vertexType, primitiveType, vptr, vertices.Length * sizeof(T), vertices.Length);
-            if (result) Interop.Throw();
-        }
-    }
-
-    /// <summary>Draw primitives with <see cref="VertexBuffer{T}"/> on this RenderContext.</summary>
-    public void DrawPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType) where T : unmanaged
-    {
-        EnsureState();
-        ThrowHelper.ThrowIfNull(buffer);
-        if (buffer.Indexed)
-            throw new InvalidOperationException(SR.BufferIsIndexed);
-        totalDrawCalls++;
-
-        bool result = Interop.SLX_DrawBufferPrimitives(buffer.NativeHandle, primitiveType, buffer.VerticesCount);
-        if (result) Interop.Throw();
-    }
-
-    /// <summary>Draw <strong>indexed</strong> primitives with <see cref="VertexBuffer{T}"/> on this RenderContext.</summary>
-    public void DrawIndexedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType) where T : unmanaged
-    {
-        EnsureState();
-        ThrowHelper.ThrowIfNull(buffer);
-        if (!buffer.Indexed)
-            throw new InvalidOperationException(SR.BufferIsNotIndexed);
-        totalDrawCalls++;
-
-        bool result = Interop.SLX_DrawIndexedBufferPrimitives(buffer.NativeHandle, primitiveType, buffer.IndicesCount);
-        if (result) Interop.Throw();
-    }
-
-    public void SetTexture(int index, Texture2D texture)
-    {
-        EnsureState();
-        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
-        ThrowHelper.ThrowIfNull(texture);
-        ThrowHelper.ThrowIfDisposed(texture.IsDisposed, texture);
-
-        PreviewStateChanged?.Invoke(RenderContextState.Texture);
-        if (Interop.SLX_SetTexture(index, texture.NativeHandle))
-            Interop.Throw();
-        StateChanged?.Invoke(RenderContextState.Texture);
-    }
-
-    internal void OnResourceDisposed(GraphicsResource resource)
-    {
-        // nothing here (just for now)
-        // TODO set references to this resource to null
-    }
-
-    public void SetSampler(int index, Sampler sampler)
-    {
-        EnsureState();
-        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
-        ThrowHelper.ThrowIfNull(sampler);
-        ThrowHelper.ThrowIfDisposed(sampler.IsDisposed, sampler);
-
-        PreviewStateChanged?.Invoke(RenderContextState.Sampler);
-        bool result = Interop.SLX_SetSampler(index, sampler.NativeHandle);
-        if (result) Interop.Throw();
-        StateChanged?.Invoke(RenderContextState.Sampler);
-    }
-
-    private void EnsureState()
-        => ThrowHelper.ThrowIfDisposed(nativeHandle == IntPtr.Zero, this);
+using System.Drawing;
+using System.Runtime.InteropServices;
+using System.Text;
+
+namespace Saladim.Salix;
+
+// TODO dispose impl
+public sealed class RenderContext
+{
+    private readonly Dictionary<VertexDeclaration, IntPtr> vertexDeclarations;
+    private readonly Dictionary<string, int> uniformBlockBindings;
+    private readonly List<Action> queuedActions;
+    private readonly int creationThreadId;
+    private readonly IntPtr nativeHandle;
+    private readonly double vSyncFrameTime = 0d;
+    private readonly GLErrorPolicy glErrorPolicy;
+    private readonly GpuProfiler gpuProfiler;
+    private Shader? currentShader;
+    private RenderTarget? currentRenderTarget = null;
+    private Rectangle viewport;
+    private bool vSyncEnabled = false;
+    private bool recordingBundle;
+    private Shader? shaderBeforeBundle;
+    private long drawCallsBeforeBundle;
+
+    private long totalDrawCalls;
+    private Size windowSize;
+    private string? programCacheDirectory;
+    private bool programCacheEnabled;
+    private int shaderCompilerThreads = -1;
+    private bool parallelShaderCompileSupported = true;
+
+    internal IntPtr NativeHandle => nativeHandle;
+
+    public long TotalDrawCalls => totalDrawCalls;
+
+    public GLErrorPolicy GLErrorPolicy => glErrorPolicy;
+
+    /// <summary>GPU timing of named scopes, see <see cref="GpuProfiler.Enabled"/>.</summary>
+    public GpuProfiler GpuProfiler { get { EnsureState(); return gpuProfiler; } }
+
+    /// <summary>Count of the GL binding and state calls made natively.</summary>
+    public long BindsIssued { get { EnsureState(); return QueryBindStats().issued; } }
+
+    /// <summary>Count of the GL binding and state calls skipped as the native state shadow already matched.</summary>
+    public long BindsSkipped { get { EnsureState(); return QueryBindStats().skipped; } }
+
+    /// <summary>Count of the shader parameter values uploaded to GL.</summary>
+    public long UniformUploads { get { EnsureState(); return QueryUniformStats().uploaded; } }
+
+    /// <summary>Count of the shader parameter uploads skipped as the program already held the same value.</summary>
+    public long UniformUploadsSkipped { get { EnsureState(); return QueryUniformStats().skipped; } }
+
+    /// <summary>
+    /// Where linked shader programs are saved as driver binaries, so later launches load them instead of compiling.
+    /// Only shaders created after setting it are cached, <see langword="null"/> disables the cache.
+    /// The directory is created if it doesn't exist.
+    /// </summary>
+    public string? ProgramCacheDirectory
+    {
+        get { EnsureState(); return programCacheDirectory; }
+        set
+        {
+            EnsureState();
+            SetProgramCacheDirectory(value);
+        }
+    }
+
+    /// <summary>
+    /// Whether shader programs are being cached, false when <see cref="ProgramCacheDirectory"/> isn't set or
+    /// the driver can't save program binaries.
+    /// </summary>
+    public bool IsProgramCacheEnabled { get { EnsureState(); return programCacheEnabled; } }
+
+    /// <summary>
+    /// Threads the driver may use to compile shaders created with <c>compileInBackground</c>, -1 leaves it to
+    /// the driver and 0 compiles on the render thread. Ignored unless <see cref="IsParallelShaderCompileSupported"/>.
+    /// </summary>
+    public int ShaderCompilerThreads
+    {
+        get { EnsureState(); return shaderCompilerThreads; }
+        set
+        {
+            EnsureState();
+            if (value < -1) throw new ArgumentOutOfRangeException(nameof(value));
+            if (Interop.SLX_SetShaderCompilerThreads(value, out var supported))
+                Interop.Throw();
+            shaderCompilerThreads = value;
+            parallelShaderCompileSupported = supported;
+        }
+    }
+
+    /// <summary>Whether the driver can compile shaders in the background, known once <see cref="ShaderCompilerThreads"/> was set.</summary>
+    public bool IsParallelShaderCompileSupported { get { EnsureState(); return parallelShaderCompileSupported; } }
+
+    /// <summary>Count of the shaders loaded from the program cache.</summary>
+    public long ProgramCacheHits { get { EnsureState(); return QueryProgramCacheStats().hits; } }
+
+    /// <summary>Count of the shaders compiled from source while the program cache was enabled.</summary>
+    public long ProgramCacheMisses { get { EnsureState(); return QueryProgramCacheStats().misses; } }
+
+    public Rectangle Viewport
+    {
+        get { EnsureState(); return viewport; }
+        set
+        {
+            EnsureState();
+            PreviewStateChanged?.Invoke(RenderContextState.Viewport);
+            if (Interop.SLX_Viewport(value.X, value.Y, value.Width, value.Height))
+                Interop.Throw();
+            viewport = value;
+            StateChanged?.Invoke(RenderContextState.Viewport);
+        }
+    }
+
+    /// <summary>Indicates is this <see cref="RenderContext"/> enabled the Vertical Synchronization.</summary>
+    public bool VSyncEnabled
+    {
+        get { EnsureState(); return vSyncEnabled; }
+        set { EnsureState(); Interop.SLX_SetVSyncEnabled(value); vSyncEnabled = value; }
+    }
+
+    /// <summary>The frame time will be when the <see cref="VSyncEnabled"/> is true.</summary>
+    public double VSyncFrameTime
+    {
+        get { EnsureState(); return vSyncFrameTime; }
+    }
+
+    public RenderTarget? RenderTarget
+    {
+        get { EnsureState(); return currentRenderTarget; }
+        set
+        {
+            if (currentRenderTarget == value) return;
+            PreviewStateChanged?.Invoke(RenderContextState.RenderTarget);
+            if (value is null)
+            {
+                if (Interop.SLX_SetRenderTarget(IntPtr.Zero))
+                    Interop.Throw();
+                Viewport = new(0, 0, windowSize.Width, windowSize.Height);
+            }
+            else
+            {
+                if (Interop.SLX_SetRenderTarget(value.NativeHandle))
+                    Interop.Throw();
+                Viewport = new(0, 0, value.Width, value.Height);
+            }
+            currentRenderTarget = value;
+            StateChanged?.Invoke(RenderContextState.RenderTarget);
+        }
+    }
+
+    public Shader? Shader
+    {
+        get { EnsureState(); return currentShader; }
+        set
+        {
+            if (currentShader == value) return;
+            PreviewStateChanged?.Invoke(RenderContextState.Shader);
+            bool result = value is not null ?
+                Interop.SLX_SetShader(value.NativeHandle) :
+                Interop.SLX_SetShader(IntPtr.Zero);
+            if (result) Interop.Throw();
+            currentShader = value;
+            StateChanged?.Invoke(RenderContextState.Shader);
+        }
+    }
+
+    public event Action<RenderContextState>? StateChanged;
+    public event Action<RenderContextState>? PreviewStateChanged;
+
+    public RenderContext(GLErrorPolicy glErrorPolicy = GLErrorPolicy.PerCall)
+    {
+        this.glErrorPolicy = glErrorPolicy;
+        vertexDeclarations = new();
+        uniformBlockBindings = new();
+        queuedActions = new(8);
+        creationThreadId = Environment.CurrentManagedThreadId;
+        vSyncFrameTime = Interop.SLX_GetVSyncFrameTime();
+        var rc = Interop.SLX_CreateRenderContext(glErrorPolicy);
+        if (rc == IntPtr.Zero)
+            throw new FrameworkException(SR.FailedToCreateRenderContext, Interop.SLX_GetError());
+        nativeHandle = rc;
+        gpuProfiler = new(this);
+    }
+
+    internal void ProcessQueuedActions()
+    {
+        lock (queuedActions)
+        {
+            foreach (var item in queuedActions)
+                item();
+            queuedActions.Clear();
+        }
+    }
+
+    internal void OnWindowResized(Window _, int width, int height)
+    {
+        windowSize = new(width, height);
+        if (RenderTarget is null)
+            Viewport = new(0, 0, width, height);
+    }
+
+    internal void AttachToWindow(Window window)
+    {
+        if (Interop.SLX_AttachRenderContext(window.NativeHandle, NativeHandle))
+            throw new FrameworkException(SR.FailedToAttachRenderContext, Interop.SLX_GetError());
+        window.Resized += OnWindowResized;
+    }
+
+    /// <summary>Invoke an action on the RenderContext creation thread.</summary>
+    public void Invoke(Action action)
+    {
+        if (Environment.CurrentManagedThreadId != creationThreadId)
+            lock (queuedActions)
+                queuedActions.Add(action);
+        else
+            action();
+    }
+
+    /// <summary>Clear this RenderContext in a color.</summary>
+    public void Clear(Color color)
+    {
+        EnsureState();
+        if (Interop.SLX_Clear(color.R, color.G, color.B, color.A))
+            Interop.Throw();
+    }
+
+    internal unsafe IntPtr SafeGetVertexType(VertexDeclaration vertexDeclaration)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(vertexDeclaration);
+        if (!vertexDeclarations.TryGetValue(vertexDeclaration, out IntPtr vertexType))
+        {
+            fixed (VertexElementType* ptr = vertexDeclaration.Elements)
+            {
+                vertexType = Interop.SLX_RegisterVertexType(ptr, vertexDeclaration.Elements.Length, vertexDeclaration.InstanceCount);
+                if (vertexType == IntPtr.Zero) Interop.Throw();
+                vertexDeclarations.Add(vertexDeclaration, vertexType);
+            }
+        }
+        return vertexType;
+    }
+
+    /// <summary>Draw primitives with <typeparamref name="T"/>* on this RenderContext.</summary>
+    public unsafe void DrawPrimitives<T>(
+        VertexDeclaration vertexDeclaration,
+        PrimitiveType primitiveType,
+        ReadOnlySpan<T> vertices
+        ) where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(vertexDeclaration);
+        totalDrawCalls++;
+
+        IntPtr vertexType = SafeGetVertexType(vertexDeclaration);
+        fixed (T* vptr = vertices)
+        {
+            bool result = Interop.SLX_DrawPrimitives(vertexType, primitiveType, vptr, vertices.Length * sizeof(T), vertices.Length);
+            if (result) Interop.Throw();
+        }
+    }
+
+    /// <summary>Draw <strong>indexed</strong> primitives with <typeparamref name="T"/>*, both copied into the streaming buffer.</summary>
+    [CLSCompliant(false)]
+    public unsafe void DrawIndexedPrimitives<T>(
+        VertexDeclaration vertexDeclaration,
+        PrimitiveType primitiveType,
+        ReadOnlySpan<T> vertices,
+        ReadOnlySpan<ushort> indices
+        ) where T : unmanaged
+    {
+        fixed (ushort* iptr = indices)
+            DrawIndexedPrimitives(vertexDeclaration, primitiveType, vertices, iptr, indices.Length * sizeof(ushort), IndexType.UInt16);
+    }
+
+    /// <summary>Draw <strong>indexed</strong> primitives with <typeparamref name="T"/>*, both copied into the streaming buffer.</summary>
+    [CLSCompliant(false)]
+    public unsafe void DrawIndexedPrimitives<T>(
+        VertexDeclaration vertexDeclaration,
+        PrimitiveType primitiveType,
+        ReadOnlySpan<T> vertices,
+        ReadOnlySpan<uint> indices
+        ) where T : unmanaged
+    {
+        fixed (uint* iptr = indices)
+            DrawIndexedPrimitives(vertexDeclaration, primitiveType, vertices, iptr, indices.Length * sizeof(uint), IndexType.UInt32);
+    }
+
+    private unsafe void DrawIndexedPrimitives<T>(
+        VertexDeclaration vertexDeclaration,
+        PrimitiveType primitiveType,
+        ReadOnlySpan<T> vertices,
+        void* indices, int indicesSize, IndexType indexType
+        ) where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(vertexDeclaration);
+        totalDrawCalls++;
+
+        IntPtr vertexType = SafeGetVertexType(vertexDeclaration);
+        fixed (T* vptr = vertices)
+        {
+            bool result = Interop.SLX_DrawIndexedPrimitives(vertexType, primitiveType, vptr, vertices.Length * sizeof(T), indices, indicesSize, indexType);
+            if (result) Interop.Throw();
+        }
+    }
+
+    /// <summary>
+    /// Reserve <paramref name="count"/> vertices in the per-frame streaming buffer and write them in place.
+    /// The returned span is only valid until the next map or streaming draw.
+    /// </summary>
+    /// <param name="offset">Byte offset of the reserved range, pass it to <see cref="DrawStreamPrimitives"/>.</param>
+    public unsafe Span<T> MapStreamBuffer<T>(int count, out int offset) where T : unmanaged
+    {
+        EnsureState();
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count), SR.ValueMustBePositive);
+
+        void* ptr = Interop.SLX_MapStreamBuffer(checked(count * sizeof(T)), sizeof(T), out offset);
+        if (ptr is null) Interop.Throw();
+        return new Span<T>(ptr, count);
+    }
+
+    /// <summary>Draw primitives from a range returned by <see cref="MapStreamBuffer{T}(int, out int)"/>.</summary>
+    public void DrawStreamPrimitives(VertexDeclaration vertexDeclaration, PrimitiveType primitiveType, int offset, int verticesCount)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(vertexDeclaration);
+        totalDrawCalls++;
+
+        IntPtr vertexType = SafeGetVertexType(vertexDeclaration);
+        bool result = Interop.SLX_DrawStreamPrimitives(vertexType, primitiveType, offset, verticesCount);
+        if (result) Interop.Throw();
+    }
+
+    /// <summary>Draw primitives with <see cref="VertexBuffer{T}"/> on this RenderContext.</summary>
+    public void DrawPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(buffer);
+        DrawPrimitives(buffer, primitiveType, 0, buffer.VerticesCount);
+    }
+
+    /// <summary>Draw <paramref name="count"/> vertices of <paramref name="buffer"/> starting at <paramref name="first"/>.</summary>
+    public void DrawPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, int first, int count) where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(buffer);
+        if (buffer.Indexed)
+            throw new InvalidOperationException(SR.BufferIsIndexed);
+        ThrowIfRangeOutOfBounds(first, count, buffer.VerticesCount);
+        totalDrawCalls++;
+
+        bool result = Interop.SLX_DrawBufferPrimitives(buffer.NativeHandle, primitiveType, first, count);
+        if (result) Interop.Throw();
+    }
+
+    /// <summary>Draw <strong>indexed</strong> primitives with <see cref="VertexBuffer{T}"/> on this RenderContext.</summary>
+    public void DrawIndexedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(buffer);
+        DrawIndexedPrimitives(buffer, primitiveType, 0, buffer.IndicesCount);
+    }
+
+    /// <summary>
+    /// Draw <paramref name="count"/> indices of <paramref name="buffer"/> starting at <paramref name="firstIndex"/>,
+    /// <paramref name="baseVertex"/> is added to every index so several meshes can share the buffer.
+    /// </summary>
+    public void DrawIndexedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, int firstIndex, int count, int baseVertex = 0) where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(buffer);
+        if (!buffer.Indexed)
+            throw new InvalidOperationException(SR.BufferIsNotIndexed);
+        ThrowIfRangeOutOfBounds(firstIndex, count, buffer.IndicesCount);
+        totalDrawCalls++;
+
+        bool result = Interop.SLX_DrawIndexedBufferPrimitives(buffer.NativeHandle, primitiveType, firstIndex, count, baseVertex);
+        if (result) Interop.Throw();
+    }
+
+    /// <summary>Draw <paramref name="instanceCount"/> instances of the vertices in <paramref name="buffer"/>.</summary>
+    public void DrawInstancedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, int instanceCount) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(buffer);
+        DrawInstancedPrimitives(buffer, primitiveType, 0, buffer.VerticesCount, instanceCount);
+    }
+
+    /// <summary>Draw <paramref name="instanceCount"/> instances of <paramref name="count"/> vertices starting at <paramref name="first"/>.</summary>
+    public void DrawInstancedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, int first, int count, int instanceCount) where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(buffer);
+        if (buffer.Indexed)
+            throw new InvalidOperationException(SR.BufferIsIndexed);
+        ThrowIfRangeOutOfBounds(first, count, buffer.VerticesCount);
+        if (instanceCount <= 0) throw new ArgumentOutOfRangeException(nameof(instanceCount), SR.ValueMustBePositive);
+        totalDrawCalls++;
+
+        bool result = Interop.SLX_DrawInstanced(buffer.NativeHandle, primitiveType, first, count, instanceCount);
+        if (result) Interop.Throw();
+    }
+
+    /// <summary>Draw <paramref name="instanceCount"/> instances of the <strong>indexed</strong> vertices in <paramref name="buffer"/>.</summary>
+    public void DrawIndexedInstancedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, int instanceCount) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(buffer);
+        DrawIndexedInstancedPrimitives(buffer, primitiveType, 0, buffer.IndicesCount, 0, instanceCount);
+    }
+
+    /// <summary>Draw <paramref name="instanceCount"/> instances of a range of the <strong>indexed</strong> vertices in <paramref name="buffer"/>.</summary>
+    public void DrawIndexedInstancedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, int firstIndex, int count, int baseVertex, int instanceCount)
+        where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(buffer);
+        if (!buffer.Indexed)
+            throw new InvalidOperationException(SR.BufferIsNotIndexed);
+        ThrowIfRangeOutOfBounds(firstIndex, count, buffer.IndicesCount);
+        if (instanceCount <= 0) throw new ArgumentOutOfRangeException(nameof(instanceCount), SR.ValueMustBePositive);
+        totalDrawCalls++;
+
+        bool result = Interop.SLX_DrawIndexedInstanced(buffer.NativeHandle, primitiveType, firstIndex, count, baseVertex, instanceCount);
+        if (result) Interop.Throw();
+    }
+
+    /// <summary>
+    /// Draw every range of <paramref name="ranges"/> from the <strong>indexed</strong> <paramref name="buffer"/> in a single call,
+    /// for many small meshes packed in one buffer.
+    /// </summary>
+    public unsafe void MultiDrawIndexedPrimitives<T>(VertexBuffer<T> buffer, PrimitiveType primitiveType, ReadOnlySpan<IndexedDrawRange> ranges)
+        where T : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(buffer);
+        if (!buffer.Indexed)
+            throw new InvalidOperationException(SR.BufferIsNotIndexed);
+        if (ranges.IsEmpty) return;
+        int indicesCount = buffer.IndicesCount;
+        foreach (ref readonly IndexedDrawRange range in ranges)
+            ThrowIfRangeOutOfBounds(range.FirstIndex, range.Count, indicesCount);
+        totalDrawCalls++;
+
+        fixed (IndexedDrawRange* ptr = ranges)
+        {
+            if (Interop.SLX_MultiDrawIndexed(buffer.NativeHandle, primitiveType, ptr, ranges.Length))
+                Interop.Throw();
+        }
+    }
+
+    private static void ThrowIfRangeOutOfBounds(int first, int count, int available)
+    {
+        if (first < 0) throw new ArgumentOutOfRangeException(nameof(first), SR.ValueCannotBeNegative);
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count), SR.ValueMustBePositive);
+        if (first > available - count) throw new ArgumentOutOfRangeException(nameof(count), SR.DrawRangeOutOfBounds);
+    }
+
+    /// <summary>Expand and draw <paramref name="sprites"/> natively, texture changes are batched on the native side.</summary>
+    /// <param name="instanced">Upload one instance per sprite and expand them in the vertex shader instead.</param>
+    internal unsafe void SubmitSprites(ReadOnlySpan<Interop.SpriteDesc> sprites, bool instanced)
+    {
+        EnsureState();
+        if (sprites.IsEmpty) return;
+
+        PreviewStateChanged?.Invoke(RenderContextState.Texture);
+        fixed (Interop.SpriteDesc* ptr = sprites)
+        {
+            bool result = instanced ?
+                Interop.SLX_SubmitSpriteInstances(ptr, sprites.Length, out int drawCalls) :
+                Interop.SLX_SubmitSprites(ptr, sprites.Length, out drawCalls);
+            totalDrawCalls += drawCalls;
+            if (result) Interop.Throw();
+        }
+        StateChanged?.Invoke(RenderContextState.Texture);
+    }
+
+    public void SetTexture(int index, Texture2D texture)
+    {
+        EnsureState();
+        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
+        ThrowHelper.ThrowIfNull(texture);
+        ThrowHelper.ThrowIfDisposed(texture.IsDisposed, texture);
+
+        PreviewStateChanged?.Invoke(RenderContextState.Texture);
+        if (Interop.SLX_SetTexture(index, texture.NativeHandle))
+            Interop.Throw();
+        StateChanged?.Invoke(RenderContextState.Texture);
+    }
+
+    public void SetTextureArray(int index, TextureArray textureArray)
+    {
+        EnsureState();
+        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
+        ThrowHelper.ThrowIfNull(textureArray);
+        ThrowHelper.ThrowIfDisposed(textureArray.IsDisposed, textureArray);
+
+        PreviewStateChanged?.Invoke(RenderContextState.Texture);
+        if (Interop.SLX_SetTextureArray(index, textureArray.NativeHandle))
+            Interop.Throw();
+        StateChanged?.Invoke(RenderContextState.Texture);
+    }
+
+    internal void OnResourceDisposed(GraphicsResource resource)
+    {
+        // nothing here (just for now)
+        // TODO set references to this resource to null
+    }
+
+    /// <summary>
+    /// Start recording shader, texture, sampler, shader parameter and draw calls into a <see cref="CommandBundle"/>
+    /// instead of executing them. Other draws and viewport, clear or render target changes are not allowed until
+    /// <see cref="EndBundle"/>.
+    /// </summary>
+    public void BeginBundle()
+    {
+        EnsureState();
+        if (recordingBundle) throw new InvalidOperationException(SR.BundleAlreadyRecording);
+        if (Interop.SLX_BeginBundle())
+            Interop.Throw();
+
+        // state set while recording must be recorded even if it is already current
+        recordingBundle = true;
+        shaderBeforeBundle = currentShader;
+        currentShader = null;
+        drawCallsBeforeBundle = totalDrawCalls;
+    }
+
+    /// <summary>Stop recording and return the recorded <see cref="CommandBundle"/>.</summary>
+    public CommandBundle EndBundle()
+    {
+        EnsureState();
+        if (!recordingBundle) throw new InvalidOperationException(SR.BundleNotRecording);
+
+        IntPtr handle = Interop.SLX_EndBundle();
+        if (handle == IntPtr.Zero) Interop.Throw();
+        CommandBundle bundle = new(this, handle, totalDrawCalls - drawCallsBeforeBundle, currentShader);
+        recordingBundle = false;
+        currentShader = shaderBeforeBundle;
+        shaderBeforeBundle = null;
+        totalDrawCalls = drawCallsBeforeBundle;
+        return bundle;
+    }
+
+    /// <summary>Replay a <see cref="CommandBundle"/> with one native call.</summary>
+    public void ExecuteBundle(CommandBundle bundle)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(bundle);
+        ThrowHelper.ThrowIfDisposed(bundle.IsDisposed, bundle);
+
+        PreviewStateChanged?.Invoke(RenderContextState.Shader);
+        PreviewStateChanged?.Invoke(RenderContextState.Texture);
+        if (Interop.SLX_ExecuteBundle(bundle.NativeHandle))
+            Interop.Throw();
+        totalDrawCalls += bundle.DrawCalls;
+        if (bundle.LastShader is not null)
+            currentShader = bundle.LastShader;
+        StateChanged?.Invoke(RenderContextState.Shader);
+        StateChanged?.Invoke(RenderContextState.Texture);
+    }
+
+    /// <summary>Decode and execute all the commands in <paramref name="stream"/> natively, then reset it.</summary>
+    public unsafe void SubmitCommandStream(CommandStream stream)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(stream);
+        if (stream.CommandsCount == 0) return;
+
+        PreviewStateChanged?.Invoke(RenderContextState.Shader);
+        PreviewStateChanged?.Invoke(RenderContextState.Texture);
+        if (stream.LastViewport is not null)
+            PreviewStateChanged?.Invoke(RenderContextState.Viewport);
+
+        ReadOnlySpan<byte> data = stream.AsSpan();
+        fixed (byte* ptr = data)
+        {
+            if (Interop.SLX_SubmitCommandStream(ptr, data.Length))
+                Interop.Throw();
+        }
+        totalDrawCalls += stream.DrawCalls;
+        if (stream.ShaderSet)
+            currentShader = stream.LastShader;
+        if (stream.LastViewport is Rectangle rect)
+            viewport = rect;
+
+        StateChanged?.Invoke(RenderContextState.Shader);
+        StateChanged?.Invoke(RenderContextState.Texture);
+        if (stream.LastViewport is not null)
+            StateChanged?.Invoke(RenderContextState.Viewport);
+        stream.Reset();
+    }
+
+    public void SetSampler(int index, Sampler sampler)
+    {
+        EnsureState();
+        if (index < 0) throw new ArgumentOutOfRangeException(nameof(index), SR.ValueCannotBeNegative);
+        ThrowHelper.ThrowIfNull(sampler);
+        ThrowHelper.ThrowIfDisposed(sampler.IsDisposed, sampler);
+
+        PreviewStateChanged?.Invoke(RenderContextState.Sampler);
+        bool result = Interop.SLX_SetSampler(index, sampler.NativeHandle);
+        if (result) Interop.Throw();
+        StateChanged?.Invoke(RenderContextState.Sampler);
+    }
+
+    /// <summary>Whether textures of <paramref name="format"/> can be created, the compressed ones depend on GL extensions.</summary>
+    public bool IsFormatSupported(ImageFormat format)
+    {
+        EnsureState();
+        if (Interop.SLX_IsImageFormatSupported(format, out var supported))
+            Interop.Throw();
+        return supported;
+    }
+
+    /// <summary>
+    /// The binding point of the uniform block named <paramref name="blockName"/>,
+    /// the same in every shader declaring the block.
+    /// </summary>
+    public unsafe int GetUniformBlockBinding(string blockName)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfNull(blockName);
+        if (uniformBlockBindings.TryGetValue(blockName, out int binding))
+            return binding;
+
+        byte[] utf8NameBytes = Encoding.UTF8.GetBytes(blockName + '\0');
+        fixed (byte* ptr = utf8NameBytes)
+            binding = Interop.SLX_GetUniformBlockBinding(ptr);
+        if (binding == -1) Interop.Throw();
+        uniformBlockBindings.Add(blockName, binding);
+        return binding;
+    }
+
+    /// <summary>Bind <paramref name="buffer"/> to the uniform block named <paramref name="blockName"/> of all shaders.</summary>
+    public void SetUniformBuffer(string blockName, UniformBuffer buffer)
+        => SetUniformBuffer(GetUniformBlockBinding(blockName), buffer);
+
+    public void SetUniformBuffer(int binding, UniformBuffer buffer)
+    {
+        EnsureState();
+        if (binding < 0) throw new ArgumentOutOfRangeException(nameof(binding), SR.ValueCannotBeNegative);
+        ThrowHelper.ThrowIfNull(buffer);
+        ThrowHelper.ThrowIfDisposed(buffer.IsDisposed, buffer);
+
+        OnUniformBufferChanging();
+        if (Interop.SLX_BindUniformBuffer(binding, buffer.NativeHandle))
+            Interop.Throw();
+        StateChanged?.Invoke(RenderContextState.UniformBuffer);
+    }
+
+    internal void OnUniformBufferChanging()
+        => PreviewStateChanged?.Invoke(RenderContextState.UniformBuffer);
+
+    /// <summary>Throw the GL error found at swap time by the <see cref="GLErrorPolicy.PerFrame"/> or <see cref="GLErrorPolicy.DebugCallback"/> policy.</summary>
+    internal unsafe void ThrowIfGLErrorReported()
+    {
+        if (glErrorPolicy is GLErrorPolicy.PerCall) return;
+        if (Interop.SLX_GetGLErrorReport(out var report))
+            Interop.Throw();
+        if (report.code == ErrorCode.OK) return;
+
+        string site;
+        if (report.function != IntPtr.Zero)
+            site = $"{Marshal.PtrToStringAnsi(report.function)}:{report.line}";
+        else if (report.message[0] != 0)
+            site = Encoding.UTF8.GetString(report.message, IndexOfZero(report.message, 256));
+        else
+            site = SR.UnknownGLErrorSite;
+        throw new FrameworkException(string.Format(SR.GLErrorReported, glErrorPolicy, site), report.code);
+
+        static int IndexOfZero(byte* str, int max)
+        {
+            int i = 0;
+            while (i < max && str[i] != 0) i++;
+            return i;
+        }
+    }
+
+    /// <summary>
+    /// Counters of the native layer since they were last reset. <see cref="Game"/> resets them after every frame
+    /// and keeps the result in <see cref="Game.LastFrameStats"/>.
+    /// </summary>
+    public FrameStats GetFrameStats(bool reset)
+    {
+        EnsureState();
+        if (Interop.SLX_GetFrameStats(out var stats, reset))
+            Interop.Throw();
+        return new(stats);
+    }
+
+    private unsafe void SetProgramCacheDirectory(string? directory)
+    {
+        if (!string.IsNullOrEmpty(directory))
+            directory = Directory.CreateDirectory(directory!).FullName;
+        Interop.NBool enabled;
+        fixed (char* ptr = directory)
+        {
+            if (Interop.SLX_SetProgramCacheDirectory(ptr, out enabled))
+                Interop.Throw();
+        }
+        programCacheDirectory = directory;
+        programCacheEnabled = enabled;
+    }
+
+    private static Interop.ProgramCacheStats QueryProgramCacheStats()
+    {
+        if (Interop.SLX_GetProgramCacheStats(out var stats))
+            Interop.Throw();
+        return stats;
+    }
+
+    private static Interop.BindStats QueryBindStats()
+    {
+        if (Interop.SLX_QueryBindStats(out var stats))
+            Interop.Throw();
+        return stats;
+    }
+
+    private static Interop.UniformStats QueryUniformStats()
+    {
+        if (Interop.SLX_QueryUniformStats(out var stats))
+            Interop.Throw();
+        return stats;
+    }
+
+    private void EnsureState()
+        => ThrowHelper.ThrowIfDisposed(nativeHandle == IntPtr.Zero, this);
 }
\ No newline at end of file
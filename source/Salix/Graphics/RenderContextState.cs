@@ -1,12 +1,13 @@
-﻿namespace Saladim.Salix;
-
-public enum RenderContextState
-{
-    Viewport = 1,
-    RenderTarget,
-    Shader,
-    Sampler,
-    Texture
-    //BlendMode
-    //Scissor
-}
+namespace Saladim.Salix;
+
+public enum RenderContextState
+{
+    Viewport = 1,
+    RenderTarget,
+    Shader,
+    Sampler,
+    Texture,
+    UniformBuffer
+    //BlendMode
+    //Scissor
+}
@@ -0,0 +1,38 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// Shader, texture, sampler, shader parameter and draw calls recorded by
+/// <see cref="RenderContext.BeginBundle"/> and <see cref="RenderContext.EndBundle"/>,
+/// replayed natively with one call to <see cref="RenderContext.ExecuteBundle(CommandBundle)"/>.
+/// </summary>
+/// <remarks>The resources used while recording must outlive the bundle.</remarks>
+public sealed class CommandBundle : GraphicsResource
+{
+    private IntPtr nativeHandle;
+    private readonly long drawCalls;
+    private readonly Shader? lastShader;
+
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+
+    /// <summary>Count of the draw calls recorded.</summary>
+    public long DrawCalls { get { EnsureState(); return drawCalls; } }
+
+    /// <summary>The shader set last while recording, current after executing.</summary>
+    internal Shader? LastShader => lastShader;
+
+    internal CommandBundle(RenderContext context, IntPtr nativeHandle, long drawCalls, Shader? lastShader)
+        : base(context)
+    {
+        this.nativeHandle = nativeHandle;
+        this.drawCalls = drawCalls;
+        this.lastShader = lastShader;
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        if (Interop.SLX_DeleteBundle(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
+}
@@ -1,134 +1,294 @@
-using System.Numerics;
-using System.Runtime.CompilerServices;
-using System.Text;
-
-namespace Saladim.Salix;
-
-public sealed class Shader : GraphicsResource
-{
-    private IntPtr nativeHandle;
-    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
-
-    [CLSCompliant(false)]
-    public unsafe Shader(RenderContext context, byte* vertSource, byte* fragSource)
-        : base(context)
-    {
-        nativeHandle = Interop.SLX_CreateShaderFromGlsl(vertSource, fragSource);
-        if (nativeHandle == IntPtr.Zero) Interop.Throw();
-    }
-
-    public unsafe Shader(RenderContext context, ReadOnlySpan<byte> vertSource, ReadOnlySpan<byte> fragSource)
-        : base(context)
-    {
-        fixed (byte* vptr = vertSource)
-        fixed (byte* fptr = fragSource)
-        {
-            nativeHandle = Interop.SLX_CreateShaderFromGlsl(vptr, fptr);
-            if (nativeHandle == IntPtr.Zero) Interop.Throw();
-        }
-    }
-
-    public ShaderParameter GetParameter(string name)
-        => new(this, GetParameterLocation(name));
-
-    public ShaderParameter GetParameter(ReadOnlySpan<byte> nameUtf8)
-        => new(this, GetParameterLocation(nameUtf8));
-
-    public void Use()
-        => RenderContext.Shader = this;
-
-    protected override void Dispose(bool disposing)
-    {
-        base.Dispose(disposing);
-        if (Interop.SLX_DeleteShader(nativeHandle))
-            Interop.Throw();
-        nativeHandle = IntPtr.Zero;
-    }
-
-    private int GetParameterLocation(string name)
-    {
-        EnsureState();
-#if NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER
-        int ret = Interop.SLX_GetShaderParamLocation(nativeHandle, name);
-        if (ret == -2) Interop.Throw();
-        return ret;
-#else
-        byte[] utf8NameBytes = Encoding.UTF8.GetBytes(name);
-        unsafe
-        {
-            fixed (byte* ptr = utf8NameBytes)
-            {
-                int ret = Interop.SLX_GetShaderParamLocation(nativeHandle, ptr);
-                if (ret == -2) Interop.Throw();
-                return ret;
-            }
-        }
-#endif
-    }
-
-    private unsafe int GetParameterLocation(ReadOnlySpan<byte> nameUtf8)
-    {
-        EnsureState();
-        fixed (byte* ptr = nameUtf8)
-        {
-            int ret = Interop.SLX_GetShaderParamLocation(nativeHandle, ptr);
-            if (ret == -2) Interop.Throw();
-            return ret;
-        }
-    }
-
-    public unsafe void SetParameter<T>(ShaderParameter param, ref T value) where T : unmanaged
-    {
-        if (!ReferenceEquals(param.Shader, this))
-            throw new ArgumentException(SR.UnmatchedShaderParamOwner, nameof(param));
-        EnsureState();
-        int location = param.Location;
-
-        if (typeof(T) == typeof(int))
-        {
-            if (Interop.SLX_SetShaderParamInt(nativeHandle, location, Unsafe.As<T, int>(ref value)))
-                Interop.Throw();
-            return;
-        }
-
-        if (typeof(T) == typeof(bool))
-        {
-            if (Interop.SLX_SetShaderParamInt(nativeHandle, location, Unsafe.As<T, bool>(ref value) ? 1 : 0))
-                Interop.Throw();
-            return;
-        }
-
-        if (typeof(T) == typeof(float))
-        {
-            if (Interop.SLX_SetShaderParamFloat(nativeHandle, location, Unsafe.As<T, float>(ref value)))
-                Interop.Throw();
-            return;
-        }
-
-        if (typeof(T) == typeof(Vector4))
-        {
-            ref var vec = ref Unsafe.As<T, Vector4>(ref value);
-            if (Interop.SLX_SetShaderParamVec4(nativeHandle, location, (float*)Unsafe.AsPointer(ref vec)))
-                Interop.Throw();
-            return;
-        }
-
-        if (typeof(T) == typeof(Matrix3x2))
-        {
-            ref var mat = ref Unsafe.As<T, Matrix3x2>(ref value);
-            if (Interop.SLX_SetShaderParamMat3x2(nativeHandle, location, (float*)Unsafe.AsPointer(ref mat)))
-                Interop.Throw();
-            return;
-        }
-
-        if (typeof(T) == typeof(Matrix4x4))
-        {
-            ref var mat = ref Unsafe.As<T, Matrix4x4>(ref value);
-            if (Interop.SLX_SetShaderParamMat4(nativeHandle, location, (float*)Unsafe.AsPointer(ref mat)))
-                Interop.Throw();
-            return;
-        }
-
-        throw new NotSupportedException(string.Format(SR.TypeNotSupportedInShader, typeof(T)));
-    }
+using System.Numerics;
+using System.Runtime.CompilerServices;
+using System.Text;
+
+namespace Saladim.Salix;
+
+public sealed class Shader : GraphicsResource
+{
+    private IntPtr nativeHandle;
+    private bool ready;
+    private ShaderParameterInfo[]? parameters;
+    private ShaderUniformBlockInfo[]? uniformBlocks;
+    private Dictionary<string, int>? parameterIndices;
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+
+    /// <summary>
+    /// Whether the driver has finished compiling and linking, polling never blocks.
+    /// Throws if the build failed, <see cref="Log"/> tells why.
+    /// </summary>
+    public bool IsReady
+    {
+        get
+        {
+            EnsureState();
+            if (!ready)
+            {
+                if (Interop.SLX_IsShaderReady(nativeHandle, out var isReady))
+                    ThrowBuildFailed();
+                ready = isReady;
+            }
+            return ready;
+        }
+    }
+
+    /// <summary>Output of the compiler and linker, empty until <see cref="IsReady"/>.</summary>
+    public unsafe string Log
+    {
+        get
+        {
+            EnsureState();
+            int length = Interop.SLX_GetShaderLog(nativeHandle, null, 0);
+            if (length == 0) return string.Empty;
+            byte[] buffer = new byte[length + 1];
+            fixed (byte* ptr = buffer)
+            {
+                Interop.SLX_GetShaderLog(nativeHandle, ptr, buffer.Length);
+                return Encoding.UTF8.GetString(ptr, length);
+            }
+        }
+    }
+
+    /// <summary>Every active uniform, read from the driver once. Waits for the build if it isn't <see cref="IsReady"/>.</summary>
+    public IReadOnlyList<ShaderParameterInfo> Parameters { get { EnsureState(); LoadReflection(); return parameters!; } }
+
+    /// <summary>Every active uniform block, the members are in <see cref="Parameters"/>.</summary>
+    public IReadOnlyList<ShaderUniformBlockInfo> UniformBlocks { get { EnsureState(); LoadReflection(); return uniformBlocks!; } }
+
+    [CLSCompliant(false)]
+    public unsafe Shader(RenderContext context, byte* vertSource, byte* fragSource)
+        : this(context, vertSource, fragSource, false)
+    {
+    }
+
+    /// <param name="compileInBackground">
+    /// Return before the driver has compiled the shader, see <see cref="IsReady"/>. Using it earlier waits for the build.
+    /// </param>
+    [CLSCompliant(false)]
+    public unsafe Shader(RenderContext context, byte* vertSource, byte* fragSource, bool compileInBackground)
+        : base(context)
+    {
+        nativeHandle = Interop.SLX_CreateShaderAsync(vertSource, fragSource);
+        if (nativeHandle == IntPtr.Zero) Interop.Throw();
+        if (!compileInBackground)
+            Wait();
+    }
+
+    public Shader(RenderContext context, ReadOnlySpan<byte> vertSource, ReadOnlySpan<byte> fragSource)
+        : this(context, vertSource, fragSource, false)
+    {
+    }
+
+    /// <inheritdoc cref="Shader(RenderContext, byte*, byte*, bool)"/>
+    public unsafe Shader(RenderContext context, ReadOnlySpan<byte> vertSource, ReadOnlySpan<byte> fragSource, bool compileInBackground)
+        : base(context)
+    {
+        fixed (byte* vptr = vertSource)
+        fixed (byte* fptr = fragSource)
+        {
+            nativeHandle = Interop.SLX_CreateShaderAsync(vptr, fptr);
+            if (nativeHandle == IntPtr.Zero) Interop.Throw();
+        }
+        if (!compileInBackground)
+            Wait();
+    }
+
+    /// <summary>Block until the driver has compiled and linked the shader, throws if the build failed.</summary>
+    public void Wait()
+    {
+        EnsureState();
+        if (ready) return;
+        if (Interop.SLX_WaitShader(nativeHandle))
+            ThrowBuildFailed();
+        ready = true;
+    }
+
+    private void ThrowBuildFailed()
+    {
+        ErrorCode error = Interop.SLX_GetError();
+        if (error is ErrorCode.ShaderCompileFailed or ErrorCode.ShaderLinkFailed)
+            throw new FrameworkException(string.Format(SR.ShaderBuildFailed, Log), error);
+        throw new FrameworkException(error);
+    }
+
+    public ShaderParameter GetParameter(string name)
+        => new(this, GetParameterLocation(name));
+
+    /// <summary>Get a parameter by its position in <see cref="Parameters"/>, uniform block members are invalid ones.</summary>
+    public ShaderParameter GetParameter(int index)
+    {
+        IReadOnlyList<ShaderParameterInfo> list = Parameters;
+        if ((uint)index >= (uint)list.Count)
+            throw new ArgumentOutOfRangeException(nameof(index));
+        return new(this, list[index].Location);
+    }
+
+    public ShaderParameter GetParameter(ReadOnlySpan<byte> nameUtf8)
+        => new(this, GetParameterLocation(nameUtf8));
+
+    public void Use()
+        => RenderContext.Shader = this;
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        if (Interop.SLX_DeleteShader(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
+
+    private unsafe void LoadReflection()
+    {
+        if (parameters is not null) return;
+
+        int blockCount = Interop.SLX_GetShaderUniformBlocks(nativeHandle, null, 0);
+        if (blockCount == -1) ThrowBuildFailed();
+        var blocks = new Interop.ShaderUniformBlockInfo[blockCount];
+        fixed (Interop.ShaderUniformBlockInfo* ptr = blocks)
+            Interop.SLX_GetShaderUniformBlocks(nativeHandle, ptr, blocks.Length);
+        uniformBlocks = new ShaderUniformBlockInfo[blockCount];
+        for (int i = 0; i < blockCount; i++)
+        {
+            fixed (byte* name = blocks[i].name)
+                uniformBlocks[i] = new(ReadName(name), blocks[i].binding, blocks[i].dataSize);
+        }
+
+        int count = Interop.SLX_GetShaderUniforms(nativeHandle, null, 0);
+        if (count == -1) ThrowBuildFailed();
+        var uniforms = new Interop.ShaderUniformInfo[count];
+        fixed (Interop.ShaderUniformInfo* ptr = uniforms)
+            Interop.SLX_GetShaderUniforms(nativeHandle, ptr, uniforms.Length);
+        var infos = new ShaderParameterInfo[count];
+        var indices = new Dictionary<string, int>(count);
+        for (int i = 0; i < count; i++)
+        {
+            ref Interop.ShaderUniformInfo u = ref uniforms[i];
+            string name;
+            fixed (byte* ptr = u.name)
+                name = ReadName(ptr);
+            string? block = u.block == -1 ? null : uniformBlocks[u.block].Name;
+            infos[i] = new(name, i, u.type, u.size, block, u.offset, u.location);
+            indices[name] = i;
+            // arrays are reported as their first element, glGetUniformLocation takes both names
+            if (name.EndsWith("[0]", StringComparison.Ordinal))
+                indices[name.Substring(0, name.Length - 3)] = i;
+        }
+        parameterIndices = indices;
+        parameters = infos;
+
+        static string ReadName(byte* str)
+        {
+            int length = 0;
+            while (length < 128 && str[length] != 0) length++;
+            return Encoding.UTF8.GetString(str, length);
+        }
+    }
+
+    private int GetParameterLocation(string name)
+    {
+        EnsureState();
+        // names outside the table, like a later array element, still go to the driver
+        LoadReflection();
+        if (parameterIndices!.TryGetValue(name, out int index) && parameters![index].Location != -1)
+            return parameters[index].Location;
+#if NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER
+        int ret = Interop.SLX_GetShaderParamLocation(nativeHandle, name);
+        if (ret == -2) Interop.Throw();
+        return ret;
+#else
+        byte[] utf8NameBytes = Encoding.UTF8.GetBytes(name);
+        unsafe
+        {
+            fixed (byte* ptr = utf8NameBytes)
+            {
+                int ret = Interop.SLX_GetShaderParamLocation(nativeHandle, ptr);
+                if (ret == -2) Interop.Throw();
+                return ret;
+            }
+        }
+#endif
+    }
+
+    private unsafe int GetParameterLocation(ReadOnlySpan<byte> nameUtf8)
+    {
+        EnsureState();
+        fixed (byte* ptr = nameUtf8)
+        {
+            int ret = Interop.SLX_GetShaderParamLocation(nativeHandle, ptr);
+            if (ret == -2) Interop.Throw();
+            return ret;
+        }
+    }
+
+    /// <summary>Apply all the updates in <paramref name="block"/> with one native call.</summary>
+    public unsafe void SetParameters(ShaderParameterBlock block)
+    {
+        ThrowHelper.ThrowIfNull(block);
+        if (block.Count == 0) return;
+        if (!ReferenceEquals(block.Shader, this))
+            throw new ArgumentException(SR.UnmatchedShaderParamOwner, nameof(block));
+        EnsureState();
+
+        ReadOnlySpan<byte> data = block.Data;
+        fixed (byte* ptr = data)
+        {
+            if (Interop.SLX_SetShaderParams(nativeHandle, ptr, data.Length))
+                Interop.Throw();
+        }
+    }
+
+    public unsafe void SetParameter<T>(ShaderParameter param, ref T value) where T : unmanaged
+    {
+        if (!ReferenceEquals(param.Shader, this))
+            throw new ArgumentException(SR.UnmatchedShaderParamOwner, nameof(param));
+        EnsureState();
+        int location = param.Location;
+
+        if (typeof(T) == typeof(int))
+        {
+            if (Interop.SLX_SetShaderParamInt(nativeHandle, location, Unsafe.As<T, int>(ref value)))
+                Interop.Throw();
+            return;
+        }
+
+        if (typeof(T) == typeof(bool))
+        {
+            if (Interop.SLX_SetShaderParamInt(nativeHandle, location, Unsafe.As<T, bool>(ref value) ? 1 : 0))
+                Interop.Throw();
+            return;
+        }
+
+        if (typeof(T) == typeof(float))
+        {
+            if (Interop.SLX_SetShaderParamFloat(nativeHandle, location, Unsafe.As<T, float>(ref value)))
+                Interop.Throw();
+            return;
+        }
+
+        if (typeof(T) == typeof(Vector4))
+        {
+            ref var vec = ref Unsafe.As<T, Vector4>(ref value);
+            if (Interop.SLX_SetShaderParamVec4(nativeHandle, location, (float*)Unsafe.AsPointer(ref vec)))
+                Interop.Throw();
+            return;
+        }
+
+        if (typeof(T) == typeof(Matrix3x2))
+        {
+            ref var mat = ref Unsafe.As<T, Matrix3x2>(ref value);
+            if (Interop.SLX_SetShaderParamMat3x2(nativeHandle, location, (float*)Unsafe.AsPointer(ref mat)))
+                Interop.Throw();
+            return;
+        }
+
+        if (typeof(T) == typeof(Matrix4x4))
+        {
+            ref var mat = ref Unsafe.As<T, Matrix4x4>(ref value);
+            if (Interop.SLX_SetShaderParamMat4(nativeHandle, location, (float*)Unsafe.AsPointer(ref mat)))
+                Interop.Throw();
+            return;
+        }
+
+        throw new NotSupportedException(string.Format(SR.TypeNotSupportedInShader, typeof(T)));
+    }
 }
\ No newline at end of file
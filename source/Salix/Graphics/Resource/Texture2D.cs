@@ -1,88 +1,301 @@
-﻿using System.Diagnostics;
-using System.Numerics;
-
-namespace Saladim.Salix;
-
-[DebuggerDisplay("Width: {Width}, Height: {Height}")]
-public sealed class Texture2D : GraphicsResource
-{
-    private IntPtr nativeHandle;
-    private int width, height;
-    private TextureFilterType filter;
-    private TextureWrapType wrap;
-    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
-
-    public int Width { get { EnsureState(); return width; } }
-    public int Height { get { EnsureState(); return height; } }
-    public Vector2 Size => new(Width, Height);
-    public Vector2 Center => Size / 2.0f;
-
-    public TextureFilterType Filter
-    {
-        get { EnsureState(); return filter; }
-        set
-        {
-            EnsureState();
-            if (Interop.SLX_SetTextureFilter(nativeHandle, value, value))
-                Interop.Throw();
-            filter = value;
-        }
-    }
-
-    public TextureWrapType Wrap
-    {
-        get { EnsureState(); return wrap; }
-        set
-        {
-            EnsureState();
-            if (Interop.SLX_SetTextureWrap(nativeHandle, value))
-                Interop.Throw();
-            wrap = value;
-        }
-    }
-
-    public Texture2D(RenderContext renderContext, int width, int height)
-        : base(renderContext)
-    {
-        (this.width, this.height) = (width, height);
-        nativeHandle = Interop.SLX_CreateTexture(width, height);
-        if (nativeHandle == IntPtr.Zero) Interop.Throw();
-        Filter = TextureFilterType.Linear;
-        Wrap = TextureWrapType.ClampToEdge;
-    }
-
-    public Texture2D(RenderContext renderContext, int width, int height, ReadOnlySpan<byte> data, ImageFormat format)
-        : this(renderContext, width, height)
-        => SetData(width, height, data, format);
-
-    [CLSCompliant(false)]
-    public unsafe Texture2D(RenderContext renderContext, int width, int height, void* data, ImageFormat format)
-        : this(renderContext, width, height)
-    {
-        if (data == null) return;
-        SetData(width, height, data, format);
-    }
-
-    public unsafe void SetData(int width, int height, ReadOnlySpan<byte> data, ImageFormat format)
-    {
-        fixed (byte* ptr = data)
-            SetData(width, height, ptr, format);
-    }
-
-    [CLSCompliant(false)]
-    public unsafe void SetData(int width, int height, void* data, ImageFormat format)
-    {
-        EnsureState();
-        (this.width, this.height) = (width, height);
-        if (Interop.SLX_SetTextureData(nativeHandle, width, height, data, format))
-            Interop.Throw();
-    }
-
-    protected override void Dispose(bool disposing)
-    {
-        base.Dispose(disposing);
-        if (Interop.SLX_DeleteTexture(nativeHandle))
-            Interop.Throw();
-        nativeHandle = IntPtr.Zero;
-    }
+using System.Diagnostics;
+using System.Numerics;
+
+namespace Saladim.Salix;
+
+[DebuggerDisplay("Width: {Width}, Height: {Height}")]
+public sealed class Texture2D : GraphicsResource
+{
+    private IntPtr nativeHandle;
+    private int width, height;
+    private readonly int mipLevels = 1;
+    private readonly bool immutable;
+    private readonly ImageFormat format;
+    private TextureFilterType filter;
+    private TextureWrapType wrap;
+    private readonly TextureAtlas? atlas;
+    private readonly Vector2 uvOffset;
+    private readonly Vector2 uvScale = Vector2.One;
+    private readonly int atlasX, atlasY;
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+
+    /// <summary>The atlas this texture was packed into, its native texture is then the shared atlas page.</summary>
+    public TextureAtlas? Atlas => atlas;
+    internal bool IsAtlased => atlas is not null;
+
+    public int Width { get { EnsureState(); return width; } }
+    public int Height { get { EnsureState(); return height; } }
+
+    /// <summary>Levels of the mip chain, only allocated up front by the immutable storage constructor.</summary>
+    public int MipLevels { get { EnsureState(); return mipLevels; } }
+
+    /// <summary>The size and format were fixed at creation, data can only be written into the existing levels.</summary>
+    public bool IsImmutable { get { EnsureState(); return immutable; } }
+    public Vector2 Size => new(Width, Height);
+    public Vector2 Center => Size / 2.0f;
+
+    public TextureFilterType Filter
+    {
+        get { EnsureState(); return filter; }
+        set
+        {
+            EnsureState();
+            ThrowIfAtlased();
+            if (Interop.SLX_SetTextureFilter(nativeHandle, value, value))
+                Interop.Throw();
+            filter = value;
+        }
+    }
+
+    public TextureWrapType Wrap
+    {
+        get { EnsureState(); return wrap; }
+        set
+        {
+            EnsureState();
+            ThrowIfAtlased();
+            if (Interop.SLX_SetTextureWrap(nativeHandle, value))
+                Interop.Throw();
+            wrap = value;
+        }
+    }
+
+    public Texture2D(RenderContext renderContext, int width, int height)
+        : base(renderContext)
+    {
+        (this.width, this.height) = (width, height);
+        nativeHandle = Interop.SLX_CreateTexture(width, height);
+        if (nativeHandle == IntPtr.Zero) Interop.Throw();
+        Filter = TextureFilterType.Linear;
+        Wrap = TextureWrapType.ClampToEdge;
+    }
+
+    /// <summary>
+    /// Create a texture with immutable storage for <paramref name="mipLevels"/> levels, 0 allocating the full chain.
+    /// The levels are filled by <see cref="SetLevelData(int, ReadOnlySpan{byte})"/>,
+    /// <see cref="SetMipChainData(ReadOnlySpan{byte})"/> or <see cref="GenerateMipmaps"/>.
+    /// </summary>
+    public Texture2D(RenderContext renderContext, int width, int height, ImageFormat format, int mipLevels)
+        : this(renderContext, width, height)
+    {
+        int maxLevels = GetMipLevelCount(width, height);
+        if (mipLevels < 0 || mipLevels > maxLevels)
+            throw new ArgumentOutOfRangeException(nameof(mipLevels));
+        this.mipLevels = mipLevels == 0 ? maxLevels : mipLevels;
+        this.format = format;
+        immutable = true;
+        if (Interop.SLX_AllocateTexture(nativeHandle, width, height, this.mipLevels, format))
+            Interop.Throw();
+    }
+
+    internal Texture2D(TextureAtlas atlas, in Interop.AtlasRegion region, int width, int height)
+        : base(atlas.RenderContext)
+    {
+        (this.width, this.height) = (width, height);
+        this.atlas = atlas;
+        nativeHandle = region.texHandle;
+        (atlasX, atlasY) = (region.x, region.y);
+        uvOffset = region.uvTopLeft;
+        uvScale = region.uvBottomRight - region.uvTopLeft;
+        filter = atlas.Filter;
+        wrap = TextureWrapType.ClampToEdge;
+    }
+
+    public Texture2D(RenderContext renderContext, int width, int height, ReadOnlySpan<byte> data, ImageFormat format)
+        : this(renderContext, width, height)
+        => SetData(width, height, data, format);
+
+    [CLSCompliant(false)]
+    public unsafe Texture2D(RenderContext renderContext, int width, int height, void* data, ImageFormat format)
+        : this(renderContext, width, height)
+    {
+        if (data == null) return;
+        SetData(width, height, data, format);
+    }
+
+    public unsafe void SetData(int width, int height, ReadOnlySpan<byte> data, ImageFormat format)
+    {
+        fixed (byte* ptr = data)
+            SetData(width, height, ptr, format);
+    }
+
+    [CLSCompliant(false)]
+    public unsafe void SetData(int width, int height, void* data, ImageFormat format)
+    {
+        EnsureState();
+        ThrowIfAtlased();
+        if (immutable)
+        {
+            // same size and format only rewrites the base level
+            ThrowIfImmutable(width != this.width || height != this.height || format != this.format);
+            SetLevelData(0, data);
+            return;
+        }
+        (this.width, this.height) = (width, height);
+        if (Interop.SLX_SetTextureData(nativeHandle, width, height, data, format))
+            Interop.Throw();
+    }
+
+    /// <summary>
+    /// Update a rectangle of the texture without reallocating it. Rows of <paramref name="data"/> are
+    /// <paramref name="stride"/> bytes apart, so the rectangle can be cut straight out of a larger image.
+    /// An atlased texture only updates its own region of the page.
+    /// </summary>
+    public unsafe void SetSubData(int x, int y, int width, int height, ReadOnlySpan<byte> data, int stride, ImageFormat format)
+    {
+        if (height > 0 && data.Length < (long)stride * (height - 1) + width * GetPixelSize(format))
+            throw new ArgumentOutOfRangeException(nameof(data), SR.TextureRegionOutOfBounds);
+        fixed (byte* ptr = data)
+            SetSubData(x, y, width, height, ptr, stride, format);
+    }
+
+    [CLSCompliant(false)]
+    public unsafe void SetSubData(int x, int y, int width, int height, void* data, int stride, ImageFormat format)
+    {
+        EnsureState();
+        if (x < 0 || y < 0 || width <= 0 || height <= 0 || width > this.width - x || height > this.height - y)
+            throw new ArgumentOutOfRangeException(nameof(x), SR.TextureRegionOutOfBounds);
+        if (stride < width * GetPixelSize(format))
+            throw new ArgumentOutOfRangeException(nameof(stride), SR.TextureRegionOutOfBounds);
+        if (Interop.SLX_SetTextureSubData(nativeHandle, atlasX + x, atlasY + y, width, height, data, stride, format))
+            Interop.Throw();
+    }
+
+    /// <summary>
+    /// Like <see cref="SetData(int, int, ReadOnlySpan{byte}, ImageFormat)"/> but without waiting for the driver,
+    /// the data is copied into a staging ring and may be reused as soon as this returns.
+    /// </summary>
+    public unsafe TextureUpload SetDataAsync(int width, int height, ReadOnlySpan<byte> data, ImageFormat format)
+    {
+        ThrowHelper.ThrowIfInvalid(data.IsEmpty, SR.ImageDataIsNull);
+        if (data.Length < (long)width * height * GetPixelSize(format))
+            throw new ArgumentOutOfRangeException(nameof(data), SR.TextureRegionOutOfBounds);
+        fixed (byte* ptr = data)
+            return SetDataAsync(width, height, ptr, format);
+    }
+
+    [CLSCompliant(false)]
+    public unsafe TextureUpload SetDataAsync(int width, int height, void* data, ImageFormat format)
+    {
+        EnsureState();
+        ThrowIfAtlased();
+        ThrowIfImmutable(immutable);
+        // the staging ring copies whole pixels, block compressed data goes through SetData
+        GetPixelSize(format);
+        long token = Interop.SLX_SetTextureDataAsync(nativeHandle, width, height, data, format);
+        if (token == 0) Interop.Throw();
+        (this.width, this.height) = (width, height);
+        return new TextureUpload(token);
+    }
+
+    /// <summary>Number of levels in a full mip chain, down to 1x1.</summary>
+    public static int GetMipLevelCount(int width, int height)
+    {
+        int levels = 1;
+        for (int size = Math.Max(width, height); size > 1; size >>= 1)
+            levels++;
+        return levels;
+    }
+
+    /// <summary>Width and height of a level of the mip chain.</summary>
+    public (int Width, int Height) GetLevelSize(int level)
+    {
+        EnsureState();
+        return (Math.Max(width >> level, 1), Math.Max(height >> level, 1));
+    }
+
+    /// <summary>Upload one precomputed level of an immutable texture, tightly packed in its storage format.</summary>
+    public unsafe void SetLevelData(int level, ReadOnlySpan<byte> data)
+    {
+        EnsureState();
+        ThrowIfNotImmutable();
+        var (w, h) = GetLevelSize(level);
+        if (data.Length < GetDataSize(format, w, h))
+            throw new ArgumentOutOfRangeException(nameof(data), SR.TextureRegionOutOfBounds);
+        fixed (byte* ptr = data)
+            SetLevelData(level, ptr);
+    }
+
+    [CLSCompliant(false)]
+    public unsafe void SetLevelData(int level, void* data)
+    {
+        EnsureState();
+        ThrowIfNotImmutable();
+        if (level < 0 || level >= mipLevels)
+            throw new ArgumentOutOfRangeException(nameof(level));
+        var (w, h) = GetLevelSize(level);
+        if (Interop.SLX_SetTextureLevelData(nativeHandle, level, w, h, data, format))
+            Interop.Throw();
+    }
+
+    /// <summary>Upload a precomputed mip chain, its levels stored one after another from the largest.</summary>
+    public void SetMipChainData(ReadOnlySpan<byte> data)
+    {
+        EnsureState();
+        for (int level = 0; level < mipLevels; level++)
+        {
+            var (w, h) = GetLevelSize(level);
+            int size = GetDataSize(format, w, h);
+            if (data.Length < size)
+                throw new ArgumentOutOfRangeException(nameof(data), SR.TextureRegionOutOfBounds);
+            SetLevelData(level, data.Slice(0, size));
+            data = data.Slice(size);
+        }
+    }
+
+    /// <summary>Downsample the base level into the rest of the mip chain on the GPU.</summary>
+    public void GenerateMipmaps()
+    {
+        EnsureState();
+        ThrowIfAtlased();
+        if (Interop.SLX_GenerateMipmaps(nativeHandle))
+            Interop.Throw();
+    }
+
+    /// <summary>Map a texture coordinate of this texture to the one on its atlas page.</summary>
+    internal Vector2 MapTextureCoord(Vector2 textureCoord)
+        => uvOffset + textureCoord * uvScale;
+
+    internal static int GetPixelSize(ImageFormat format) => format switch
+    {
+        ImageFormat.R8 => 1,
+        ImageFormat.Rg16 => 2,
+        ImageFormat.Rgb24 => 3,
+        ImageFormat.Rgba32 => 4,
+        _ => throw new ArgumentException(string.Format(SR.ImageFormatIsCompressed, format), nameof(format))
+    };
+
+    internal static int GetDataSize(ImageFormat format, int width, int height) => format switch
+    {
+        ImageFormat.Bc1 or ImageFormat.Bc4 => (width + 3) / 4 * ((height + 3) / 4) * 8,
+        ImageFormat.Bc3 or ImageFormat.Bc5 or ImageFormat.Bc7 => (width + 3) / 4 * ((height + 3) / 4) * 16,
+        _ => width * height * GetPixelSize(format)
+    };
+
+    private static void ThrowIfImmutable(bool condition)
+    {
+        if (condition)
+            throw new InvalidOperationException(SR.TextureIsImmutable);
+    }
+
+    private void ThrowIfNotImmutable()
+    {
+        if (!immutable)
+            throw new InvalidOperationException(SR.TextureHasNoMipStorage);
+    }
+
+    private void ThrowIfAtlased()
+    {
+        if (atlas is not null)
+            throw new InvalidOperationException(SR.TextureIsAtlased);
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        // the page belongs to the atlas
+        if (atlas is null && Interop.SLX_DeleteTexture(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
 }
\ No newline at end of file
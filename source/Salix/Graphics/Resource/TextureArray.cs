@@ -0,0 +1,76 @@
+using System.Diagnostics;
+using System.Numerics;
+
+namespace Saladim.Salix;
+
+/// <summary>
+/// Layers of same sized images sampled by one sampler2DArray. Sprites drawn from any of the layers
+/// with <see cref="SpriteBatch.DrawTextureLayer(TextureArray, int, DrawTransform)"/> share one batch.
+/// </summary>
+[DebuggerDisplay("Width: {Width}, Height: {Height}, Layers: {Layers}")]
+public sealed class TextureArray : GraphicsResource
+{
+    private IntPtr nativeHandle;
+    private readonly int width, height, layers;
+    private readonly ImageFormat format;
+    private readonly TextureFilterType filter;
+    private readonly TextureWrapType wrap;
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+
+    public int Width { get { EnsureState(); return width; } }
+    public int Height { get { EnsureState(); return height; } }
+    public int Layers { get { EnsureState(); return layers; } }
+    public Vector2 Size => new(Width, Height);
+    public ImageFormat Format { get { EnsureState(); return format; } }
+    public TextureFilterType Filter { get { EnsureState(); return filter; } }
+    public TextureWrapType Wrap { get { EnsureState(); return wrap; } }
+
+    public TextureArray(
+        RenderContext renderContext,
+        int width, int height, int layers,
+        ImageFormat format = ImageFormat.Rgba32,
+        TextureFilterType filter = TextureFilterType.Linear,
+        TextureWrapType wrap = TextureWrapType.ClampToEdge
+        )
+        : base(renderContext)
+    {
+        if (width <= 0) throw new ArgumentOutOfRangeException(nameof(width), SR.ValueMustBePositive);
+        if (height <= 0) throw new ArgumentOutOfRangeException(nameof(height), SR.ValueMustBePositive);
+        if (layers <= 0) throw new ArgumentOutOfRangeException(nameof(layers), SR.ValueMustBePositive);
+        if (filter is not (TextureFilterType.Linear or TextureFilterType.Nearest))
+            throw new ArgumentException(SR.MipmapFilterNotSupported, nameof(filter));
+
+        (this.width, this.height, this.layers) = (width, height, layers);
+        (this.format, this.filter, this.wrap) = (format, filter, wrap);
+        nativeHandle = Interop.SLX_CreateTextureArray(width, height, layers, format, filter, wrap);
+        if (nativeHandle == IntPtr.Zero) Interop.Throw();
+    }
+
+    /// <summary>Copy the image <paramref name="data"/> into <paramref name="layer"/>, it must be as large as the array.</summary>
+    public unsafe void SetLayerData(int layer, ReadOnlySpan<byte> data, ImageFormat format)
+    {
+        ThrowHelper.ThrowIfInvalid(data.IsEmpty, SR.ImageDataIsNull);
+        if (data.Length < (long)width * height * Texture2D.GetPixelSize(format))
+            throw new ArgumentOutOfRangeException(nameof(data), SR.TextureRegionOutOfBounds);
+        fixed (byte* ptr = data)
+            SetLayerData(layer, ptr, format);
+    }
+
+    [CLSCompliant(false)]
+    public unsafe void SetLayerData(int layer, void* data, ImageFormat format)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(data is null, SR.ImageDataIsNull);
+        if (layer < 0 || layer >= layers) throw new ArgumentOutOfRangeException(nameof(layer));
+        if (Interop.SLX_SetTextureArrayLayer(nativeHandle, layer, width, height, data, format))
+            Interop.Throw();
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        if (Interop.SLX_DeleteTexture(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
+}
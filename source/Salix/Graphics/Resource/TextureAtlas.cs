@@ -0,0 +1,86 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// Packs small textures into shared pages natively. A <see cref="Texture2D"/> added here draws from its page,
+/// so sprites using different atlased textures stay in one batch.
+/// </summary>
+/// <remarks>Space isn't reclaimed when an atlased texture is disposed, the pages live until the atlas is disposed.</remarks>
+public sealed class TextureAtlas : GraphicsResource
+{
+    // api_graphics.cpp atlas_padding
+    private const int Padding = 1;
+
+    private IntPtr nativeHandle;
+    private readonly int pageSize;
+    private readonly int maxTextureSize;
+    private readonly TextureFilterType filter;
+    private int count;
+
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+
+    /// <summary>Width and height of the pages.</summary>
+    public int PageSize { get { EnsureState(); return pageSize; } }
+
+    /// <summary>Textures wider or higher than this are not packed.</summary>
+    public int MaxTextureSize { get { EnsureState(); return maxTextureSize; } }
+
+    public TextureFilterType Filter { get { EnsureState(); return filter; } }
+
+    /// <summary>Count of the textures added.</summary>
+    public int Count { get { EnsureState(); return count; } }
+
+    public TextureAtlas(
+        RenderContext renderContext,
+        int pageSize = 2048,
+        int maxTextureSize = 256,
+        TextureFilterType filter = TextureFilterType.Linear
+        )
+        : base(renderContext)
+    {
+        if (pageSize <= 0) throw new ArgumentOutOfRangeException(nameof(pageSize), SR.ValueMustBePositive);
+        if (maxTextureSize <= 0) throw new ArgumentOutOfRangeException(nameof(maxTextureSize), SR.ValueMustBePositive);
+        if (maxTextureSize > pageSize - Padding * 2)
+            throw new ArgumentOutOfRangeException(nameof(maxTextureSize), SR.AtlasTextureSizeTooBig);
+        if (filter is not (TextureFilterType.Linear or TextureFilterType.Nearest))
+            throw new ArgumentException(SR.MipmapFilterNotSupported, nameof(filter));
+
+        (this.pageSize, this.maxTextureSize, this.filter) = (pageSize, maxTextureSize, filter);
+        nativeHandle = Interop.SLX_CreateTextureAtlas(pageSize, filter);
+        if (nativeHandle == IntPtr.Zero) Interop.Throw();
+    }
+
+    public bool CanHold(int width, int height)
+        => width > 0 && height > 0 && width <= MaxTextureSize && height <= MaxTextureSize;
+
+    public unsafe Texture2D Add(int width, int height, ReadOnlySpan<byte> data, ImageFormat format)
+    {
+        ThrowHelper.ThrowIfInvalid(data.IsEmpty, SR.ImageDataIsNull);
+        if (data.Length < (long)width * height * Texture2D.GetPixelSize(format))
+            throw new ArgumentOutOfRangeException(nameof(data), SR.TextureRegionOutOfBounds);
+        fixed (byte* ptr = data)
+            return Add(width, height, ptr, format);
+    }
+
+    /// <summary>Pack the image into a page, opening a new page when none has room.</summary>
+    [CLSCompliant(false)]
+    public unsafe Texture2D Add(int width, int height, void* data, ImageFormat format)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(data is null, SR.ImageDataIsNull);
+        if (!CanHold(width, height))
+            throw new ArgumentOutOfRangeException(nameof(width), SR.TextureTooBigForAtlas);
+
+        if (Interop.SLX_AddAtlasImage(nativeHandle, width, height, data, format, out var region))
+            Interop.Throw();
+        count++;
+        return new Texture2D(this, region, width, height);
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        if (Interop.SLX_DeleteTextureAtlas(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
+}
@@ -0,0 +1,60 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// A buffer holding the values of a uniform block, laid out as std140 in the shaders.
+/// Blocks with the same name share one binding point across every shader, so per-frame or per-view
+/// constants are uploaded once and bound with <see cref="RenderContext.SetUniformBuffer(string, UniformBuffer)"/>.
+/// </summary>
+public sealed class UniformBuffer : GraphicsResource
+{
+    private readonly int size;
+    private IntPtr nativeHandle;
+
+    /// <summary>Size of the buffer in bytes.</summary>
+    public int Size { get { EnsureState(); return size; } }
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+
+    public UniformBuffer(RenderContext context, int size, VertexBufferDataUsage dataUsage = VertexBufferDataUsage.DynamicDraw)
+        : base(context)
+    {
+        if (size <= 0) throw new ArgumentOutOfRangeException(nameof(size), SR.ValueMustBePositive);
+
+        this.size = size;
+        nativeHandle = Interop.SLX_CreateUniformBuffer(size, dataUsage);
+        if (nativeHandle == IntPtr.Zero) Interop.Throw();
+    }
+
+    /// <summary>Copy <paramref name="value"/> into the buffer at <paramref name="offset"/> bytes.</summary>
+    public unsafe void SetData<T>(T value, int offset = 0) where T : unmanaged
+        => SetData(&value, sizeof(T), offset);
+
+    /// <summary>Copy the data from a <paramref name="span"/> into the buffer at <paramref name="offset"/> bytes.</summary>
+    public unsafe void SetData<T>(ReadOnlySpan<T> span, int offset = 0) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.UniformDataIsNull);
+        fixed (T* data = span)
+            SetData(data, sizeof(T) * span.Length, offset);
+    }
+
+    /// <summary>Copy <paramref name="dataSize"/> bytes from <paramref name="data"/> into the buffer at <paramref name="offset"/> bytes.</summary>
+    [CLSCompliant(false)]
+    public unsafe void SetData(void* data, int dataSize, int offset = 0)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(data is null, SR.UniformDataIsNull);
+        if (offset < 0 || dataSize <= 0 || dataSize > size - offset)
+            throw new ArgumentOutOfRangeException(nameof(offset), SR.UniformBufferRangeOutOfBounds);
+
+        RenderContext.OnUniformBufferChanging();
+        if (Interop.SLX_SetUniformBufferData(nativeHandle, offset, data, dataSize))
+            Interop.Throw();
+    }
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        if (Interop.SLX_DeleteUniformBuffer(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
+}
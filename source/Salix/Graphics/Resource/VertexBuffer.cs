@@ -1,101 +1,242 @@
-﻿namespace Saladim.Salix;
-
-/// <summary>
-/// A type of Buffer used to store vertices data
-/// </summary>
-/// <typeparam name="T">Vertex type, must be unmanged</typeparam>
-public sealed class VertexBuffer<T> : GraphicsResource where T : unmanaged
-{
-    private readonly VertexDeclaration vertexDeclaration;
-    private readonly bool indexed;
-    private readonly VertexBufferDataUsage dataUsage;
-    private IntPtr nativeHandle;
-    private int verticesCount;
-    private int indicesCount;
-
-    public VertexDeclaration VertexDeclaration { get { EnsureState(); return vertexDeclaration; } }
-    public bool Indexed { get { EnsureState(); return indexed; } }
-    public int IndicesCount { get { EnsureState(); return indicesCount; } }
-    public int VerticesCount { get { EnsureState(); return verticesCount; } }
-    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
-
-    public VertexBuffer(
-        RenderContext context,
-        VertexDeclaration vertexDeclaration,
-        VertexBufferDataUsage dataUsage = VertexBufferDataUsage.StaticDraw,
-        bool indexed = false
-        ) : base(context)
-    {
-        ThrowHelper.ThrowIfNull(vertexDeclaration);
-
-        this.dataUsage = dataUsage;
-        this.indexed = indexed;
-        this.vertexDeclaration = vertexDeclaration;
-        nativeHandle = Interop.SLX_CreateVertexBuffer(context.SafeGetVertexType(vertexDeclaration), indexed);
-        if (nativeHandle == IntPtr.Zero) Interop.Throw();
-        indicesCount = -1;
-        verticesCount = -1;
-    }
-
-    /// <summary>Copy and set the data from an <paramref name="array"/></summary>
-    public unsafe void SetData(T[] array)
-    {
-        ThrowHelper.ThrowIfNull(array);
-        SetData(array.AsSpan());
-    }
-
-    /// <summary>Copy and set the data from a <paramref name="span"/></summary>
-    public unsafe void SetData(ReadOnlySpan<T> span)
-    {
-        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
-        fixed (T* data = span)
-            SetData(data, span.Length);
-    }
-
-    /// <summary>Copy and set the data from a pointer <paramref name="data"/></summary>
-    [CLSCompliant(false)]
-    public unsafe void SetData(T* data, int count)
-    {
-        EnsureState();
-        ThrowHelper.ThrowIfInvalid(data is null, SR.VerticesDataIsNull);
-        verticesCount = count;
-        if (Interop.SLX_SetVertexBufferData(nativeHandle, data, sizeof(T) * count, dataUsage))
-            Interop.Throw();
-    }
-
-    /// <summary>Copy and set the data from an <paramref name="array"/></summary>
-    [CLSCompliant(false)]
-    public unsafe void SetIndexData(ushort[] array)
-    {
-        ThrowHelper.ThrowIfNull(array);
-        SetIndexData(array.AsSpan());
-    }
-
-    /// <summary>Copy and set the data from a <paramref name="span"/></summary>
-    [CLSCompliant(false)]
-    public unsafe void SetIndexData(ReadOnlySpan<ushort> span)
-    {
-        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
-        fixed (ushort* ptr = span)
-            SetIndexData(ptr, span.Length);
-    }
-
-    /// <summary>Copy and set the data from a pointer <paramref name="ptr"/></summary>
-    [CLSCompliant(false)]
-    public unsafe void SetIndexData(ushort* data, int count)
-    {
-        EnsureState();
-        ThrowHelper.ThrowIfInvalid(data is null, SR.VerticesDataIsNull);
-        indicesCount = count;
-        if (Interop.SLX_SetIndexBufferData(nativeHandle, data, sizeof(ushort) * count, dataUsage))
-            Interop.Throw();
-    }
-
-    protected override void Dispose(bool disposing)
-    {
-        base.Dispose(disposing);
-        if (Interop.SLX_DeleteVertexBuffer(nativeHandle))
-            Interop.Throw();
-        nativeHandle = IntPtr.Zero;
-    }
+namespace Saladim.Salix;
+
+/// <summary>
+/// A type of Buffer used to store vertices data
+/// </summary>
+/// <typeparam name="T">Vertex type, must be unmanged</typeparam>
+public sealed class VertexBuffer<T> : GraphicsResource where T : unmanaged
+{
+    private readonly VertexDeclaration vertexDeclaration;
+    private readonly bool indexed;
+    private readonly VertexBufferDataUsage dataUsage;
+    private IntPtr nativeHandle;
+    private int verticesCount;
+    private int indicesCount;
+    private int instancesCount;
+    private IndexType indexType;
+
+    public VertexDeclaration VertexDeclaration { get { EnsureState(); return vertexDeclaration; } }
+    public bool Indexed { get { EnsureState(); return indexed; } }
+    public int IndicesCount { get { EnsureState(); return indicesCount; } }
+    public int VerticesCount { get { EnsureState(); return verticesCount; } }
+    public int InstancesCount { get { EnsureState(); return instancesCount; } }
+    /// <summary>The type of the last index data set, <see cref="IndexType.UInt16"/> before any.</summary>
+    public IndexType IndexType { get { EnsureState(); return indexType; } }
+    internal IntPtr NativeHandle { get { EnsureState(); return nativeHandle; } }
+    internal VertexBufferDataUsage DataUsage => dataUsage;
+
+    public VertexBuffer(
+        RenderContext context,
+        VertexDeclaration vertexDeclaration,
+        VertexBufferDataUsage dataUsage = VertexBufferDataUsage.StaticDraw,
+        bool indexed = false
+        ) : base(context)
+    {
+        ThrowHelper.ThrowIfNull(vertexDeclaration);
+
+        this.dataUsage = dataUsage;
+        this.indexed = indexed;
+        this.vertexDeclaration = vertexDeclaration;
+        nativeHandle = Interop.SLX_CreateVertexBuffer(context.SafeGetVertexType(vertexDeclaration), indexed);
+        if (nativeHandle == IntPtr.Zero) Interop.Throw();
+        indicesCount = -1;
+        verticesCount = -1;
+        instancesCount = -1;
+        indexType = IndexType.UInt16;
+    }
+
+    /// <summary>Copy and set the data from an <paramref name="array"/></summary>
+    public unsafe void SetData(T[] array)
+    {
+        ThrowHelper.ThrowIfNull(array);
+        SetData(array.AsSpan());
+    }
+
+    /// <summary>Copy and set the data from a <paramref name="span"/></summary>
+    public unsafe void SetData(ReadOnlySpan<T> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (T* data = span)
+            SetData(data, span.Length);
+    }
+
+    /// <summary>Copy and set the data from a pointer <paramref name="data"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetData(T* data, int count)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(data is null, SR.VerticesDataIsNull);
+        verticesCount = count;
+        if (Interop.SLX_SetVertexBufferData(nativeHandle, data, sizeof(T) * count, dataUsage))
+            Interop.Throw();
+    }
+
+    /// <summary>Allocate room for <paramref name="count"/> vertices without data, to be filled by <see cref="SetSubData(int, ReadOnlySpan{T})"/></summary>
+    public unsafe void Allocate(int count)
+    {
+        EnsureState();
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count), SR.ValueMustBePositive);
+        verticesCount = count;
+        if (Interop.SLX_AllocateVertexBuffer(nativeHandle, checked(sizeof(T) * count), dataUsage))
+            Interop.Throw();
+    }
+
+    /// <summary>Overwrite the vertices starting at <paramref name="offset"/> with a <paramref name="span"/>, keeping the rest</summary>
+    public unsafe void SetSubData(int offset, ReadOnlySpan<T> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (T* data = span)
+            SetSubData(offset, data, span.Length);
+    }
+
+    /// <summary>Overwrite <paramref name="count"/> vertices starting at <paramref name="offset"/> from a pointer <paramref name="data"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetSubData(int offset, T* data, int count)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(data is null, SR.VerticesDataIsNull);
+        if (offset < 0 || count <= 0 || count > verticesCount - offset)
+            throw new ArgumentOutOfRangeException(nameof(offset), SR.VertexBufferRangeOutOfBounds);
+        if (Interop.SLX_SetVertexBufferSubData(nativeHandle, sizeof(T) * offset, data, sizeof(T) * count))
+            Interop.Throw();
+    }
+
+    /// <summary>Allocate room for <paramref name="count"/> indices of <paramref name="type"/> without data, to be filled by <c>SetIndexSubData</c></summary>
+    public void AllocateIndices(int count, IndexType type = IndexType.UInt16)
+    {
+        EnsureState();
+        if (count <= 0) throw new ArgumentOutOfRangeException(nameof(count), SR.ValueMustBePositive);
+        indicesCount = count;
+        indexType = type;
+        if (Interop.SLX_AllocateIndexBuffer(nativeHandle, checked(GetIndexSize(type) * count), dataUsage, type))
+            Interop.Throw();
+    }
+
+    /// <summary>Overwrite the 8-bit indices starting at <paramref name="offset"/> with a <paramref name="span"/></summary>
+    public unsafe void SetIndexSubData(int offset, ReadOnlySpan<byte> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (byte* ptr = span)
+            SetIndexSubData(offset, ptr, span.Length, IndexType.UInt8);
+    }
+
+    /// <summary>Overwrite the 16-bit indices starting at <paramref name="offset"/> with a <paramref name="span"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexSubData(int offset, ReadOnlySpan<ushort> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (ushort* ptr = span)
+            SetIndexSubData(offset, ptr, span.Length, IndexType.UInt16);
+    }
+
+    /// <summary>Overwrite the 32-bit indices starting at <paramref name="offset"/> with a <paramref name="span"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexSubData(int offset, ReadOnlySpan<uint> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (uint* ptr = span)
+            SetIndexSubData(offset, ptr, span.Length, IndexType.UInt32);
+    }
+
+    private unsafe void SetIndexSubData(int offset, void* data, int count, IndexType type)
+    {
+        EnsureState();
+        if (type != indexType)
+            throw new InvalidOperationException(SR.IndexTypeMismatch);
+        if (offset < 0 || count > indicesCount - offset)
+            throw new ArgumentOutOfRangeException(nameof(offset), SR.VertexBufferRangeOutOfBounds);
+        int size = GetIndexSize(type);
+        if (Interop.SLX_SetIndexBufferSubData(nativeHandle, size * offset, data, size * count))
+            Interop.Throw();
+    }
+
+    /// <summary>Copy and set the 8-bit index data from a <paramref name="span"/></summary>
+    public unsafe void SetIndexData(ReadOnlySpan<byte> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (byte* ptr = span)
+            SetIndexData(ptr, span.Length, IndexType.UInt8);
+    }
+
+    /// <summary>Copy and set the 16-bit index data from an <paramref name="array"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexData(ushort[] array)
+    {
+        ThrowHelper.ThrowIfNull(array);
+        SetIndexData(array.AsSpan());
+    }
+
+    /// <summary>Copy and set the 16-bit index data from a <paramref name="span"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexData(ReadOnlySpan<ushort> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (ushort* ptr = span)
+            SetIndexData(ptr, span.Length);
+    }
+
+    /// <summary>Copy and set the 16-bit index data from a pointer <paramref name="data"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexData(ushort* data, int count)
+        => SetIndexData(data, count, IndexType.UInt16);
+
+    /// <summary>Copy and set the 32-bit index data from an <paramref name="array"/>, for more than 65536 vertices</summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexData(uint[] array)
+    {
+        ThrowHelper.ThrowIfNull(array);
+        SetIndexData(array.AsSpan());
+    }
+
+    /// <summary>Copy and set the 32-bit index data from a <paramref name="span"/>, for more than 65536 vertices</summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexData(ReadOnlySpan<uint> span)
+    {
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        fixed (uint* ptr = span)
+            SetIndexData(ptr, span.Length);
+    }
+
+    /// <summary>Copy and set the 32-bit index data from a pointer <paramref name="data"/></summary>
+    [CLSCompliant(false)]
+    public unsafe void SetIndexData(uint* data, int count)
+        => SetIndexData(data, count, IndexType.UInt32);
+
+    private unsafe void SetIndexData(void* data, int count, IndexType type)
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(data is null, SR.VerticesDataIsNull);
+        indicesCount = count;
+        indexType = type;
+        if (Interop.SLX_SetIndexBufferData(nativeHandle, data, GetIndexSize(type) * count, dataUsage, type))
+            Interop.Throw();
+    }
+
+    /// <summary>
+    /// Copy and set the per-instance data from a <paramref name="span"/>,
+    /// its layout must match <see cref="VertexDeclaration.InstanceAttributes"/>.
+    /// </summary>
+    public unsafe void SetInstanceData<TInstance>(ReadOnlySpan<TInstance> span) where TInstance : unmanaged
+    {
+        EnsureState();
+        ThrowHelper.ThrowIfInvalid(span.IsEmpty, SR.VerticesDataIsNull);
+        ThrowHelper.ThrowIfInvalid(vertexDeclaration.InstanceCount == 0, SR.VertexDeclarationHasNoInstanceAttributes);
+        instancesCount = span.Length;
+        fixed (TInstance* data = span)
+        {
+            if (Interop.SLX_SetInstanceBufferData(nativeHandle, data, sizeof(TInstance) * span.Length, dataUsage))
+                Interop.Throw();
+        }
+    }
+
+    private static int GetIndexSize(IndexType type)
+        => type switch { IndexType.UInt8 => 1, IndexType.UInt16 => 2, _ => 4 };
+
+    protected override void Dispose(bool disposing)
+    {
+        base.Dispose(disposing);
+        if (Interop.SLX_DeleteVertexBuffer(nativeHandle))
+            Interop.Throw();
+        nativeHandle = IntPtr.Zero;
+    }
 }
\ No newline at end of file
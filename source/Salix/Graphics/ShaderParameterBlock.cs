@@ -0,0 +1,78 @@
+using System.Numerics;
+using System.Runtime.CompilerServices;
+
+namespace Saladim.Salix;
+
+/// <summary>
+/// A packed block of shader parameter updates for one <see cref="Salix.Shader"/>,
+/// applied in a single native call by <see cref="Shader.SetParameters(ShaderParameterBlock)"/>.
+/// </summary>
+public sealed class ShaderParameterBlock
+{
+    // api_graphics.h uniform_type
+    internal enum ShaderParamType
+    {
+        Int,
+        Float,
+        Vector4,
+        Matrix4x4,
+        Matrix3x2
+    }
+
+    private byte[] buffer;
+    private int length;
+    private Shader? shader;
+
+    /// <summary>The shader all the parameters belong to, null if the block is empty.</summary>
+    public Shader? Shader => shader;
+
+    public int Count { get; private set; }
+
+    internal ReadOnlySpan<byte> Data => new(buffer, 0, length);
+
+    public ShaderParameterBlock(int capacity = 256)
+    {
+        if (capacity <= 0) throw new ArgumentOutOfRangeException(nameof(capacity), SR.ValueMustBePositive);
+        buffer = new byte[capacity];
+    }
+
+    /// <summary>Add a parameter update, supports the same types as <see cref="Shader.SetParameter{T}(ShaderParameter, ref T)"/>.</summary>
+    public void Set<T>(ShaderParameter param, T value) where T : unmanaged
+    {
+        ThrowHelper.ThrowIfNull(param.Shader);
+        if (shader is not null && !ReferenceEquals(shader, param.Shader))
+            throw new ArgumentException(SR.UnmatchedShaderParamOwner, nameof(param));
+
+        ShaderParamType type;
+        if (typeof(T) == typeof(int) || typeof(T) == typeof(bool)) type = ShaderParamType.Int;
+        else if (typeof(T) == typeof(float)) type = ShaderParamType.Float;
+        else if (typeof(T) == typeof(Vector4)) type = ShaderParamType.Vector4;
+        else if (typeof(T) == typeof(Matrix4x4)) type = ShaderParamType.Matrix4x4;
+        else if (typeof(T) == typeof(Matrix3x2)) type = ShaderParamType.Matrix3x2;
+        else throw new NotSupportedException(string.Format(SR.TypeNotSupportedInShader, typeof(T)));
+
+        // api_graphics.h shader_param_entry
+        int valueSize = typeof(T) == typeof(bool) ? sizeof(int) : Unsafe.SizeOf<T>();
+        int required = length + 8 + valueSize;
+        if (required > buffer.Length)
+            Array.Resize(ref buffer, Math.Max(required, buffer.Length * 2));
+
+        Unsafe.WriteUnaligned(ref buffer[length], param.Location);
+        Unsafe.WriteUnaligned(ref buffer[length + 4], (int)type);
+        if (typeof(T) == typeof(bool))
+            Unsafe.WriteUnaligned(ref buffer[length + 8], Unsafe.As<T, bool>(ref value) ? 1 : 0);
+        else
+            Unsafe.WriteUnaligned(ref buffer[length + 8], value);
+        length = required;
+        shader = param.Shader;
+        Count++;
+    }
+
+    /// <summary>Remove all the updates.</summary>
+    public void Clear()
+    {
+        length = 0;
+        Count = 0;
+        shader = null;
+    }
+}
@@ -0,0 +1,71 @@
+using System.Numerics;
+
+namespace Saladim.Salix;
+
+/// <summary>An active uniform of a <see cref="Shader"/>, see <see cref="Shader.Parameters"/>.</summary>
+public readonly struct ShaderParameterInfo
+{
+    public string Name { get; }
+
+    /// <summary>The position in <see cref="Shader.Parameters"/>, for <see cref="Shader.GetParameter(int)"/>.</summary>
+    public int Index { get; }
+
+    /// <summary>The type to set it with, null if <see cref="Shader.SetParameter{T}(ShaderParameter, ref T)"/> has none for it.</summary>
+    public Type? ValueType { get; }
+
+    /// <summary>The array length, 1 if it isn't an array.</summary>
+    public int ArraySize { get; }
+
+    /// <summary>The uniform block it's declared in, null for plain parameters.</summary>
+    public string? UniformBlock { get; }
+
+    /// <summary>In bytes from the start of <see cref="UniformBlock"/>, -1 for plain parameters.</summary>
+    public int BlockOffset { get; }
+
+    internal int Location { get; }
+
+    internal ShaderParameterInfo(string name, int index, int glType, int arraySize, string? uniformBlock, int blockOffset, int location)
+    {
+        Name = name;
+        Index = index;
+        ValueType = GetValueType(glType);
+        ArraySize = arraySize;
+        UniformBlock = uniformBlock;
+        BlockOffset = blockOffset;
+        Location = location;
+    }
+
+    // the gl enums matching api_graphics.cpp uniform_type_matches
+    private static Type? GetValueType(int glType) => glType switch
+    {
+        0x1404 or 0x8B56 => typeof(int), // GL_INT, GL_BOOL
+        0x1406 => typeof(float),
+        0x8B52 => typeof(Vector4),
+        0x8B5C => typeof(Matrix4x4),
+        0x8B67 => typeof(Matrix3x2),
+        // the sampler types are set with their texture unit
+        >= 0x8B5D and <= 0x8B64 or >= 0x8DC0 and <= 0x8DC5 or >= 0x8DC9 and <= 0x8DD8 or >= 0x9108 and <= 0x910D => typeof(int),
+        _ => null
+    };
+
+    public override string ToString()
+        => UniformBlock is null ? Name : $"{UniformBlock}.{Name}";
+}
+
+/// <summary>An active uniform block of a <see cref="Shader"/>, see <see cref="Shader.UniformBlocks"/>.</summary>
+public readonly struct ShaderUniformBlockInfo
+{
+    public string Name { get; }
+
+    /// <summary>The binding point, shared by every shader declaring a block of this name.</summary>
+    public int Binding { get; }
+
+    /// <summary>The size in bytes a <see cref="UniformBuffer"/> bound to it needs.</summary>
+    public int DataSize { get; }
+
+    internal ShaderUniformBlockInfo(string name, int binding, int dataSize)
+        => (Name, Binding, DataSize) = (name, binding, dataSize);
+
+    public override string ToString()
+        => Name;
+}
@@ -0,0 +1,13 @@
+namespace Saladim.Salix;
+
+/// <summary>How a <see cref="SpriteBatch"/> turns single colored sprites into quads.</summary>
+public enum SpriteBatchMode
+{
+    /// <summary>Sprites are expanded to four vertices each on the CPU.</summary>
+    Expanded,
+    /// <summary>
+    /// Sprites are uploaded as one compact instance record each and expanded in the vertex shader,
+    /// requires <see cref="SpriteBatch.InstancedSpriteShader"/>.
+    /// </summary>
+    Instanced
+}
@@ -1,11 +1,11 @@
-﻿namespace Saladim.Salix;
-
-public enum TextureFilterType
-{
-    Linear,
-    Nearest,
-    LinearMipmapLinear,
-    LinearMipmapNearest,
-    NearestMipmapLinear,
-    NearestMipmapNearest
+namespace Saladim.Salix;
+
+public enum TextureFilterType
+{
+    Linear,
+    Nearest,
+    LinearMipmapLinear,
+    LinearMipmapNearest,
+    NearestMipmapLinear,
+    NearestMipmapNearest
 }
\ No newline at end of file
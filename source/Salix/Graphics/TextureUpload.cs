@@ -0,0 +1,25 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// A texture upload started by <see cref="Texture2D.SetDataAsync(int, int, ReadOnlySpan{byte}, ImageFormat)"/>,
+/// the pixels are staged in a pixel unpack buffer and copied into the texture by the GPU in the background.
+/// </summary>
+public readonly struct TextureUpload
+{
+    private readonly long token;
+
+    /// <summary>Whether the GPU has finished copying the pixels, polling never blocks.</summary>
+    public bool IsComplete
+    {
+        get
+        {
+            if (token == 0) return true;
+            if (Interop.SLX_IsUploadComplete(token, out var complete))
+                Interop.Throw();
+            return complete;
+        }
+    }
+
+    internal TextureUpload(long token)
+        => this.token = token;
+}
@@ -1,8 +1,8 @@
-﻿namespace Saladim.Salix;
-
-public enum TextureWrapType
-{
-    ClampToEdge,
-    Repeat,
-    MirroredRepeat
+namespace Saladim.Salix;
+
+public enum TextureWrapType
+{
+    ClampToEdge,
+    Repeat,
+    MirroredRepeat
 }
\ No newline at end of file
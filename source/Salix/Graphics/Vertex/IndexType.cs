@@ -0,0 +1,10 @@
+namespace Saladim.Salix;
+
+// ../Salix.Native/source/graphics_enums.h
+/// <summary>The element type of the indices of a <see cref="VertexBuffer{T}"/>.</summary>
+public enum IndexType
+{
+    UInt8,
+    UInt16,
+    UInt32
+}
\ No newline at end of file
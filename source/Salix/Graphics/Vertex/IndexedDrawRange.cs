@@ -0,0 +1,21 @@
+using System.Runtime.InteropServices;
+
+namespace Saladim.Salix;
+
+// ../Salix.Native/source/api_graphics.h indexed_draw_range
+/// <summary>One mesh of an index buffer, see <see cref="RenderContext.MultiDrawIndexedPrimitives{T}(VertexBuffer{T}, PrimitiveType, ReadOnlySpan{IndexedDrawRange})"/>.</summary>
+[StructLayout(LayoutKind.Sequential)]
+public struct IndexedDrawRange
+{
+    public int FirstIndex;
+    public int Count;
+    /// <summary>Added to every index before fetching the vertex, so meshes can keep indices starting at 0.</summary>
+    public int BaseVertex;
+
+    public IndexedDrawRange(int firstIndex, int count, int baseVertex = 0)
+    {
+        FirstIndex = firstIndex;
+        Count = count;
+        BaseVertex = baseVertex;
+    }
+}
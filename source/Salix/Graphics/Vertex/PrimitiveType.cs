@@ -1,12 +1,12 @@
-﻿namespace Saladim.Salix;
-
-// ../msd/graphics.cpp
-public enum PrimitiveType
-{
-    TriangleList,
-    TriangleStrip,
-    TriangleFan,
-    LineList,
-    LineStrip,
-    PointList
+namespace Saladim.Salix;
+
+// ../msd/graphics.cpp
+public enum PrimitiveType
+{
+    TriangleList,
+    TriangleStrip,
+    TriangleFan,
+    LineList,
+    LineStrip,
+    PointList
 }
\ No newline at end of file
@@ -1,20 +1,20 @@
-﻿using System.Diagnostics.CodeAnalysis;
-
-namespace Saladim.Salix;
-
-[SuppressMessage("Usage", "CA1720")]
-public enum VertexAttributeFormat
-{
-    Single,
-    Vector2,
-    Vector3,
-    Vector4,
-    Color,
-    Byte4,
-    Short2,
-    Short4,
-    NormalizedShort2,
-    NormalizedShort4,
-    HalfVector2,
-    HalfVector4
+using System.Diagnostics.CodeAnalysis;
+
+namespace Saladim.Salix;
+
+[SuppressMessage("Usage", "CA1720")]
+public enum VertexAttributeFormat
+{
+    Single,
+    Vector2,
+    Vector3,
+    Vector4,
+    Color,
+    Byte4,
+    Short2,
+    Short4,
+    NormalizedShort2,
+    NormalizedShort4,
+    HalfVector2,
+    HalfVector4
 }
\ No newline at end of file
@@ -1,9 +1,9 @@
-﻿namespace Saladim.Salix;
-
-// ../Salix.Native/source/graphics_enums.h
-public enum VertexBufferDataUsage
-{
-    StaticDraw,
-    DynamicDraw,
-    StreamDraw
+namespace Saladim.Salix;
+
+// ../Salix.Native/source/graphics_enums.h
+public enum VertexBufferDataUsage
+{
+    StaticDraw,
+    DynamicDraw,
+    StreamDraw
 }
\ No newline at end of file
@@ -1,33 +1,64 @@
-﻿namespace Saladim.Salix;
-
-public class VertexDeclaration : IEquatable<VertexDeclaration>
-{
-    private readonly int hash;
-    private readonly VertexElementType[] attr;
-
-    public int Count => Attributes.Length;
-    public ReadOnlySpan<VertexElementType> Attributes => new(attr);
-
-    public VertexDeclaration(params VertexElementType[] attributes)
-    {
-        attr = attributes;
-
-        HashCode hc = new();
-        foreach (var item in attr) hc.Add(item);
-        hash = hc.ToHashCode();
-    }
-
-    public override int GetHashCode() => hash;
-
-    public bool Equals(VertexDeclaration? other)
-        => other is not null && attr.SequenceEqual(other.attr);
-
-    public override bool Equals(object? other)
-        => other is VertexDeclaration vd && attr.SequenceEqual(vd.attr);
-
-    public static bool operator ==(VertexDeclaration? left, VertexDeclaration? right)
-        => left is not null && left.Equals(right);
-
-    public static bool operator !=(VertexDeclaration? left, VertexDeclaration? right)
-        => !(left == right);
+namespace Saladim.Salix;
+
+public class VertexDeclaration : IEquatable<VertexDeclaration>
+{
+    private readonly int hash;
+    private readonly VertexElementType[] attr;
+    private readonly int instanceCount;
+
+    public int Count => attr.Length - instanceCount;
+    public ReadOnlySpan<VertexElementType> Attributes => new(attr, 0, attr.Length - instanceCount);
+
+    /// <summary>Count of the attributes which advance once per instance instead of once per vertex.</summary>
+    public int InstanceCount => instanceCount;
+    public ReadOnlySpan<VertexElementType> InstanceAttributes => new(attr, attr.Length - instanceCount, instanceCount);
+
+    /// <summary>All the attributes, per-vertex ones first.</summary>
+    internal ReadOnlySpan<VertexElementType> Elements => new(attr);
+
+    public VertexDeclaration(params VertexElementType[] attributes)
+        : this(attributes, Array.Empty<VertexElementType>())
+    {
+    }
+
+    /// <param name="instanceAttributes">
+    /// Attributes read from the instance data of a <see cref="VertexBuffer{T}"/>,
+    /// their locations follow the <paramref name="attributes"/>.
+    /// </param>
+    public VertexDeclaration(VertexElementType[] attributes, VertexElementType[] instanceAttributes)
+    {
+        ThrowHelper.ThrowIfNull(attributes);
+        ThrowHelper.ThrowIfNull(instanceAttributes);
+
+        if (instanceAttributes.Length == 0)
+        {
+            attr = attributes;
+        }
+        else
+        {
+            attr = new VertexElementType[attributes.Length + instanceAttributes.Length];
+            attributes.CopyTo(attr, 0);
+            instanceAttributes.CopyTo(attr, attributes.Length);
+        }
+        instanceCount = instanceAttributes.Length;
+
+        HashCode hc = new();
+        foreach (var item in attr) hc.Add(item);
+        hc.Add(instanceCount);
+        hash = hc.ToHashCode();
+    }
+
+    public override int GetHashCode() => hash;
+
+    public bool Equals(VertexDeclaration? other)
+        => other is not null && instanceCount == other.instanceCount && attr.SequenceEqual(other.attr);
+
+    public override bool Equals(object? other)
+        => other is VertexDeclaration vd && Equals(vd);
+
+    public static bool operator ==(VertexDeclaration? left, VertexDeclaration? right)
+        => left is not null && left.Equals(right);
+
+    public static bool operator !=(VertexDeclaration? left, VertexDeclaration? right)
+        => !(left == right);
 }
\ No newline at end of file
@@ -1,11 +1,11 @@
-﻿namespace Saladim.Salix;
-
-// ../msd/graphics_enums.h
-public enum VertexElementType
-{
-    Single,
-    Color,
-    Vector2,
-    Vector3,
-    Vector4,
+namespace Saladim.Salix;
+
+// ../msd/graphics_enums.h
+public enum VertexElementType
+{
+    Single,
+    Color,
+    Vector2,
+    Vector3,
+    Vector4,
 }
\ No newline at end of file
@@ -0,0 +1,49 @@
+using System.Diagnostics;
+using System.Numerics;
+using System.Runtime.InteropServices;
+
+namespace Saladim.Salix;
+
+[DebuggerDisplay("position: {Position}, color: {Color}, texCoord: {TextureCoord}, layer: {Layer}")]
+[StructLayout(LayoutKind.Sequential)]
+public struct VertexPosition2DColorTextureLayer : IEquatable<VertexPosition2DColorTextureLayer>
+{
+    public static readonly VertexDeclaration VertexDeclaration;
+
+    public Vector2 Position;
+    public Color Color;
+    public Vector2 TextureCoord;
+    /// <summary>Layer of the <see cref="TextureArray"/> to sample.</summary>
+    public float Layer;
+
+    static VertexPosition2DColorTextureLayer()
+    {
+        VertexDeclaration = new(VertexElementType.Vector2, VertexElementType.Color, VertexElementType.Vector2, VertexElementType.Single);
+    }
+
+    public VertexPosition2DColorTextureLayer(Vector2 position, Color color, Vector2 textureCoord, float layer)
+    {
+        Position = position;
+        Color = color;
+        TextureCoord = textureCoord;
+        Layer = layer;
+    }
+
+    public readonly override bool Equals(object? obj)
+        => obj is VertexPosition2DColorTextureLayer texture && Equals(texture);
+
+    public readonly bool Equals(VertexPosition2DColorTextureLayer other)
+        => Position.Equals(other.Position) &&
+           Color.Equals(other.Color) &&
+           TextureCoord.Equals(other.TextureCoord) &&
+           Layer.Equals(other.Layer);
+
+    public readonly override int GetHashCode()
+        => HashCode.Combine(Position, Color, TextureCoord, Layer);
+
+    public static bool operator ==(VertexPosition2DColorTextureLayer left, VertexPosition2DColorTextureLayer right)
+        => left.Equals(right);
+
+    public static bool operator !=(VertexPosition2DColorTextureLayer left, VertexPosition2DColorTextureLayer right)
+        => !(left == right);
+}
@@ -1,9 +1,9 @@
-﻿namespace Saladim.Salix;
-
-public enum MouseButton
-{
-    None = 0,
-    Left = 1,
-    Right = 2,
-    Middle = 3
+namespace Saladim.Salix;
+
+public enum MouseButton
+{
+    None = 0,
+    Left = 1,
+    Right = 2,
+    Middle = 3
 }
\ No newline at end of file
@@ -1,45 +1,149 @@
-﻿using System.Diagnostics;
-using System.Diagnostics.CodeAnalysis;
-using System.Runtime.InteropServices;
-
-namespace Saladim.Salix;
-
-internal static partial class Interop
-{
-    private const string LibName = "slx";
-    private const CallingConvention CallConv = CallingConvention.StdCall;
-
-    [StructLayout(LayoutKind.Sequential)]
-    internal struct RECT { public int left, top, right, bottom; }
-
-    [StructLayout(LayoutKind.Sequential)]
-    internal struct RenderContextInfo { public int maxTextures; }
-
-    [DebuggerStepThrough]
-    internal struct NBool
-    {
-        public byte Value;
-
-        public static implicit operator bool(NBool @bool)
-            => @bool.Value != 0;
-
-        public static implicit operator NBool(bool @bool)
-            => new NBool() { Value = @bool ? (byte)1 : (byte)0 };
-
-        public static bool operator true(NBool @bool)
-            => @bool.Value != 0;
-
-        public static bool operator false(NBool @bool)
-            => @bool.Value == 0;
-    }
-
-    [DoesNotReturn, DebuggerStepThrough, StackTraceHidden]
-    public static void Throw()
-    {
-        ErrorCode err = SLX_GetError();
-        if (err != ErrorCode.OK)
-            throw new FrameworkException(err);
-        else
-            throw new FrameworkException(SR.ThrowOnOK);
-    }
-}
+using System.Diagnostics;
+using System.Diagnostics.CodeAnalysis;
+using System.Numerics;
+using System.Runtime.InteropServices;
+
+namespace Saladim.Salix;
+
+internal static partial class Interop
+{
+    private const string LibName = "slx";
+    private const CallingConvention CallConv = CallingConvention.StdCall;
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct RECT { public int left, top, right, bottom; }
+
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct RenderContextInfo { public int maxTextures; }
+
+    // api_graphics.h bind_stats
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct BindStats { public long issued, skipped; }
+
+    // api_graphics.h gl_error_report
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct GLErrorReport
+    {
+        public ErrorCode code;
+        public int line;
+        public IntPtr function;
+        public fixed byte message[256];
+    }
+
+    // api_graphics.h shader_uniform_info
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct ShaderUniformInfo
+    {
+        public fixed byte name[128];
+        public int type, size, location, block, offset;
+    }
+
+    // api_graphics.h shader_uniform_block_info
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct ShaderUniformBlockInfo
+    {
+        public fixed byte name[128];
+        public int binding, dataSize;
+    }
+
+    // api_resource.h image_container
+    [StructLayout(LayoutKind.Sequential)]
+    internal unsafe struct ImageContainer
+    {
+        public const int MaxLevels = 16;
+
+        public int width, height, levels;
+        public ImageFormat format;
+        public fixed int levelOffsets[MaxLevels];
+        public fixed int levelSizes[MaxLevels];
+    }
+
+    // api_graphics.h gpu_scope_result
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct GpuScopeResult
+    {
+        public int name, depth;
+        public long begin, duration;
+    }
+
+    // api_graphics.h gpu_frame_info
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct GpuFrameInfo
+    {
+        public long frame, duration;
+        public int scopeCount, droppedFrames;
+    }
+
+    // api_graphics.h uniform_stats
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct UniformStats { public long uploaded, skipped; }
+
+    // api_graphics.h program_cache_stats
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct ProgramCacheStats { public long hits, misses; }
+
+    // api_graphics.h frame_stats
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct FrameStats
+    {
+        public long draws, vertices, indices;
+        public long bufferBytes, textureBytes;
+        public BindStats textureBinds, shaderBinds, vaoBinds, fboBinds, otherBinds;
+        public UniformStats uniforms;
+        public long glErrorChecks;
+        public long apiCalls, apiNanoseconds;
+    }
+
+    // api_graphics.h atlas_region
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct AtlasRegion
+    {
+        public IntPtr texHandle;
+        public int x, y;
+        public Vector2 uvTopLeft;
+        public Vector2 uvBottomRight;
+    }
+
+    // api_graphics.h sprite_desc
+    [StructLayout(LayoutKind.Sequential)]
+    internal struct SpriteDesc
+    {
+        public IntPtr texHandle;
+        public Vector2 position;
+        public Vector2 origin;
+        public Vector2 scale;
+        public float radians;
+        public Vector2 size;
+        public Vector2 textureTopLeft;
+        public Vector2 textureBottomRight;
+        public Color color;
+    }
+
+    [DebuggerStepThrough]
+    internal struct NBool
+    {
+        public byte Value;
+
+        public static implicit operator bool(NBool @bool)
+            => @bool.Value != 0;
+
+        public static implicit operator NBool(bool @bool)
+            => new NBool() { Value = @bool ? (byte)1 : (byte)0 };
+
+        public static bool operator true(NBool @bool)
+            => @bool.Value != 0;
+
+        public static bool operator false(NBool @bool)
+            => @bool.Value == 0;
+    }
+
+    [DoesNotReturn, DebuggerStepThrough, StackTraceHidden]
+    public static void Throw()
+    {
+        ErrorCode err = SLX_GetError();
+        if (err != ErrorCode.OK)
+            throw new FrameworkException(err);
+        else
+            throw new FrameworkException(SR.ThrowOnOK);
+    }
+}
@@ -1,122 +1,234 @@
-﻿using System.Runtime.InteropServices;
-
-#pragma warning disable SYSLIB1054
-
-namespace Saladim.Salix;
-
-unsafe partial class Interop
-{
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_Initialize();
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateRenderContext();
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_AttachRenderContext(IntPtr win, IntPtr hrc);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_SwapBuffers(IntPtr win);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_SetVSyncEnabled(NBool enable);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern double SLX_GetVSyncFrameTime();
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_QueryRenderContextInfo(out RenderContextInfo info);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_Viewport(int x, int y, int width, int height);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_Clear(float r, float g, float b, float a);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_RegisterVertexType(VertexElementType* vdecl, int len);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateVertexBuffer(IntPtr vertexType, NBool indexed);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DeleteVertexBuffer(IntPtr bufferHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DrawPrimitives(IntPtr vertexType, PrimitiveType ptype, void* data, int dataSize, int verticesCount);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetVertexBufferData(IntPtr vertexBuffer, void* data, int dataSize, VertexBufferDataUsage dataUsage);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetIndexBufferData(IntPtr vertexBuffer, void* data, int dataSize, VertexBufferDataUsage dataUsage);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DrawBufferPrimitives(IntPtr bufferHandle, PrimitiveType primitiveType, int verticesCount);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DrawIndexedBufferPrimitives(IntPtr bufferHandle, PrimitiveType primitiveType, int verticesCount);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateTexture(int width, int height);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DeleteTexture(IntPtr texHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetTextureData(IntPtr texHandle, int width, int height, void* data, ImageFormat format);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetTexture(int index, IntPtr texHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetTextureFilter(IntPtr texHandle, TextureFilterType min, TextureFilterType max);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetTextureWrap(IntPtr texHandle, TextureWrapType wrap);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateSampler(TextureFilterType filter, TextureWrapType wrap);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DeleteSampler(IntPtr samplerHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetSampler(int index, IntPtr samplerHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateShaderFromGlsl(byte* vertSource, byte* fragSource);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DeleteShader(IntPtr shaderHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetShader(IntPtr shaderHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateRenderTarget(IntPtr texHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_DeleteRenderTarget(IntPtr renderTargetHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetRenderTarget(IntPtr renderTargetHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern int SLX_GetShaderParamLocation(IntPtr shaderHandle, byte* nameUtf8);
-#if NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern int SLX_GetShaderParamLocation(IntPtr shaderHandle, [MarshalAs(UnmanagedType.LPUTF8Str)] string name);
-#endif
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetShaderParamInt(IntPtr shaderHandle, int location, int value);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetShaderParamFloat(IntPtr shaderHandle, int location, float value);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetShaderParamVec4(IntPtr shaderHandle, int location, float* value);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetShaderParamMat4(IntPtr shaderHandle, int location, float* value);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern NBool SLX_SetShaderParamMat3x2(IntPtr shaderHandle, int location, float* value);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern IntPtr SLX_CreateWindow(int width, int height, char* title, IntPtr gcHandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_DestroyWindow(IntPtr win);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_PollEvents(IntPtr win);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void* SLX_BeginProcessEvents(IntPtr win, out nint count, out void* events);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_EndProcessEvents(IntPtr win, void* ehandle);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_ShowWindow(IntPtr win);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_HideWindow(IntPtr win);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_GetWindowRect(IntPtr win, out RECT rect);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_SetWindowSize(IntPtr win, int width, int height);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_SetWindowPos(IntPtr win, int x, int y);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_SetWindowTitle(IntPtr win, char* title);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern int SLX_GetWindowTitle(IntPtr win, char* title);
-#if NET5_0_OR_GREATER
-	[SuppressGCTransition]
-#endif
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern ErrorCode SLX_GetError();
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void* SLX_LoadImage(void* memory, int length, out int width, out int height, out int dataLength, out ImageFormat textureFormat);
-	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
-	internal static extern void SLX_FreeImage(void* texData);
-}
+using System.Runtime.InteropServices;
+
+#pragma warning disable SYSLIB1054
+
+namespace Saladim.Salix;
+
+unsafe partial class Interop
+{
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_Initialize();
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateRenderContext(GLErrorPolicy errorPolicy);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_AttachRenderContext(IntPtr win, IntPtr hrc);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_SwapBuffers(IntPtr win);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_SetVSyncEnabled(NBool enable);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern double SLX_GetVSyncFrameTime();
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_QueryRenderContextInfo(out RenderContextInfo info);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GetGLErrorReport(out GLErrorReport report);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_QueryBindStats(out BindStats stats);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_QueryUniformStats(out UniformStats stats);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GetFrameStats(out FrameStats stats, NBool reset);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_Viewport(int x, int y, int width, int height);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_Clear(float r, float g, float b, float a);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_RegisterVertexType(VertexElementType* vdecl, int len, int instanceLen);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateVertexBuffer(IntPtr vertexType, NBool indexed);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteVertexBuffer(IntPtr bufferHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawPrimitives(IntPtr vertexType, PrimitiveType ptype, void* data, int dataSize, int verticesCount);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawIndexedPrimitives(IntPtr vertexType, PrimitiveType ptype, void* vertices, int verticesSize, void* indices, int indicesSize, IndexType indexType);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetVertexBufferData(IntPtr vertexBuffer, void* data, int dataSize, VertexBufferDataUsage dataUsage);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_AllocateVertexBuffer(IntPtr vertexBuffer, int dataSize, VertexBufferDataUsage dataUsage);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetVertexBufferSubData(IntPtr vertexBuffer, int offset, void* data, int dataSize);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetIndexBufferData(IntPtr vertexBuffer, void* data, int dataSize, VertexBufferDataUsage dataUsage, IndexType indexType);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_AllocateIndexBuffer(IntPtr vertexBuffer, int dataSize, VertexBufferDataUsage dataUsage, IndexType indexType);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetIndexBufferSubData(IntPtr vertexBuffer, int offset, void* data, int dataSize);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawBufferPrimitives(IntPtr bufferHandle, PrimitiveType primitiveType, int first, int verticesCount);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawIndexedBufferPrimitives(IntPtr bufferHandle, PrimitiveType primitiveType, int firstIndex, int indicesCount, int baseVertex);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetInstanceBufferData(IntPtr bufferHandle, void* data, int dataSize, VertexBufferDataUsage dataUsage);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawInstanced(IntPtr bufferHandle, PrimitiveType primitiveType, int first, int verticesCount, int instanceCount);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawIndexedInstanced(IntPtr bufferHandle, PrimitiveType primitiveType, int firstIndex, int indicesCount, int baseVertex, int instanceCount);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_MultiDrawIndexed(IntPtr bufferHandle, PrimitiveType primitiveType, IndexedDrawRange* ranges, int count);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SubmitSprites(SpriteDesc* sprites, int count, out int drawCalls);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SubmitSpriteInstances(SpriteDesc* sprites, int count, out int drawCalls);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void* SLX_MapStreamBuffer(int size, int stride, out int offset);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DrawStreamPrimitives(IntPtr vertexType, PrimitiveType ptype, int offset, int verticesCount);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetGpuProfiling(NBool enabled);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GpuScopeBegin(int name);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GpuScopeEnd();
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GetGpuFrameResults(out GpuFrameInfo info, GpuScopeResult* scopes, int capacity);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateTexture(int width, int height);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteTexture(IntPtr texHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureData(IntPtr texHandle, int width, int height, void* data, ImageFormat format);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_IsImageFormatSupported(ImageFormat format, out NBool supported);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureSubData(IntPtr texHandle, int x, int y, int width, int height, void* data, int stride, ImageFormat format);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_AllocateTexture(IntPtr texHandle, int width, int height, int mipLevels, ImageFormat format);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureLevelData(IntPtr texHandle, int level, int width, int height, void* data, ImageFormat format);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GenerateMipmaps(IntPtr texHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern long SLX_SetTextureDataAsync(IntPtr texHandle, int width, int height, void* data, ImageFormat format);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_IsUploadComplete(long token, out NBool complete);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTexture(int index, IntPtr texHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateTextureArray(int width, int height, int layers, ImageFormat format, TextureFilterType filter, TextureWrapType wrap);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureArrayLayer(IntPtr texHandle, int layer, int width, int height, void* data, ImageFormat format);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureArray(int index, IntPtr texHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateTextureAtlas(int pageSize, TextureFilterType filter);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_AddAtlasImage(IntPtr atlas, int width, int height, void* data, ImageFormat format, out AtlasRegion region);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteTextureAtlas(IntPtr atlas);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureFilter(IntPtr texHandle, TextureFilterType min, TextureFilterType max);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetTextureWrap(IntPtr texHandle, TextureWrapType wrap);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateSampler(TextureFilterType filter, TextureWrapType wrap);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteSampler(IntPtr samplerHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetSampler(int index, IntPtr samplerHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateShaderAsync(byte* vertSource, byte* fragSource);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_IsShaderReady(IntPtr shader, out NBool ready);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_WaitShader(IntPtr shader);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetShaderLog(IntPtr shader, byte* log, int capacity);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderCompilerThreads(int count, out NBool supported);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetProgramCacheDirectory(char* directory, out NBool enabled);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_GetProgramCacheStats(out ProgramCacheStats stats);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteShader(IntPtr shaderHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShader(IntPtr shaderHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateRenderTarget(IntPtr texHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteRenderTarget(IntPtr renderTargetHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetRenderTarget(IntPtr renderTargetHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_BeginBundle();
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_EndBundle();
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_ExecuteBundle(IntPtr bundle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteBundle(IntPtr bundle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SubmitCommandStream(void* data, int size);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetShaderParamLocation(IntPtr shaderHandle, byte* nameUtf8);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetShaderUniforms(IntPtr shader, ShaderUniformInfo* uniforms, int capacity);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetShaderUniformBlocks(IntPtr shader, ShaderUniformBlockInfo* blocks, int capacity);
+#if NETSTANDARD2_1_OR_GREATER || NET5_0_OR_GREATER
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetShaderParamLocation(IntPtr shaderHandle, [MarshalAs(UnmanagedType.LPUTF8Str)] string name);
+#endif
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderParamInt(IntPtr shaderHandle, int location, int value);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderParamFloat(IntPtr shaderHandle, int location, float value);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderParamVec4(IntPtr shaderHandle, int location, float* value);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderParamMat4(IntPtr shaderHandle, int location, float* value);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderParamMat3x2(IntPtr shaderHandle, int location, float* value);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetShaderParams(IntPtr shaderHandle, byte* data, int size);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateUniformBuffer(int size, VertexBufferDataUsage dataUsage);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_SetUniformBufferData(IntPtr uniformBuffer, int offset, void* data, int size);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_BindUniformBuffer(int binding, IntPtr uniformBuffer);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_DeleteUniformBuffer(IntPtr uniformBuffer);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetUniformBlockBinding(byte* nameUtf8);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern IntPtr SLX_CreateWindow(int width, int height, char* title, IntPtr gcHandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_DestroyWindow(IntPtr win);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_PollEvents(IntPtr win);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void* SLX_BeginProcessEvents(IntPtr win, out nint count, out void* events);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_EndProcessEvents(IntPtr win, void* ehandle);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_ShowWindow(IntPtr win);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_HideWindow(IntPtr win);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_GetWindowRect(IntPtr win, out RECT rect);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_SetWindowSize(IntPtr win, int width, int height);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_SetWindowPos(IntPtr win, int x, int y);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_SetWindowTitle(IntPtr win, char* title);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern int SLX_GetWindowTitle(IntPtr win, char* title);
+#if NET5_0_OR_GREATER
+	[SuppressGCTransition]
+#endif
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern ErrorCode SLX_GetError();
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void* SLX_LoadImage(void* memory, int length, out int width, out int height, out int dataLength, out ImageFormat textureFormat);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern void SLX_FreeImage(void* texData);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_CompressImage(void* pixels, int width, int height, ImageFormat sourceFormat, ImageFormat targetFormat, CompressionQuality quality, void* blocks, int blocksSize, double* squaredError, long* errorSamples);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_IsImageContainer(void* memory, int length, out NBool isContainer);
+	[DllImport(LibName, CallingConvention = CallConv, ExactSpelling = true)]
+	internal static extern NBool SLX_ParseImageContainer(void* memory, int length, out ImageContainer container);
+}
@@ -1,6 +1,6 @@
-﻿namespace Saladim.Salix;
-
-public enum SalixPlatform
-{
-    Unknown, Windows, Linux, Android
+namespace Saladim.Salix;
+
+public enum SalixPlatform
+{
+    Unknown, Windows, Linux, Android
 }
\ No newline at end of file
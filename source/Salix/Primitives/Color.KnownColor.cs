@@ -1,150 +1,150 @@
-﻿namespace Saladim.Salix;
-
-public partial struct Color
-{
-    public static class Known
-    {
-        public static Color Transparent => FromRgba(0xffffff00);
-        public static Color AliceBlue => FromRgba(0xf0f8ffff);
-        public static Color AntiqueWhite => FromRgba(0xfaebd7ff);
-        public static Color Aqua => FromRgba(0x00ffffff);
-        public static Color Aquamarine => FromRgba(0x7fffd4ff);
-        public static Color Azure => FromRgba(0xf0ffffff);
-        public static Color Beige => FromRgba(0xf5f5dcff);
-        public static Color Bisque => FromRgba(0xffe4c4ff);
-        public static Color Black => FromRgba(0x000000ff);
-        public static Color BlanchedAlmond => FromRgba(0xffebcdff);
-        public static Color Blue => FromRgba(0x0000ffff);
-        public static Color BlueViolet => FromRgba(0x8a2be2ff);
-        public static Color Brown => FromRgba(0xa52a2aff);
-        public static Color BurlyWood => FromRgba(0xdeb887ff);
-        public static Color CadetBlue => FromRgba(0x5f9ea0ff);
-        public static Color Chartreuse => FromRgba(0x7fff00ff);
-        public static Color Chocolate => FromRgba(0xd2691eff);
-        public static Color Coral => FromRgba(0xff7f50ff);
-        public static Color CornflowerBlue => FromRgba(0x6495edff);
-        public static Color Cornsilk => FromRgba(0xfff8dcff);
-        public static Color Crimson => FromRgba(0xdc143cff);
-        public static Color Cyan => FromRgba(0x00ffffff);
-        public static Color DarkBlue => FromRgba(0x00008bff);
-        public static Color DarkCyan => FromRgba(0x008b8bff);
-        public static Color DarkGoldenrod => FromRgba(0xb8860bff);
-        public static Color DarkGray => FromRgba(0xa9a9a9ff);
-        public static Color DarkGreen => FromRgba(0x006400ff);
-        public static Color DarkKhaki => FromRgba(0xbdb76bff);
-        public static Color DarkMagenta => FromRgba(0x8b008bff);
-        public static Color DarkOliveGreen => FromRgba(0x556b2fff);
-        public static Color DarkOrange => FromRgba(0xff8c00ff);
-        public static Color DarkOrchid => FromRgba(0x9932ccff);
-        public static Color DarkRed => FromRgba(0x8b0000ff);
-        public static Color DarkSalmon => FromRgba(0xe9967aff);
-        public static Color DarkSeaGreen => FromRgba(0x8fbc8bff);
-        public static Color DarkSlateBlue => FromRgba(0x483d8bff);
-        public static Color DarkSlateGray => FromRgba(0x2f4f4fff);
-        public static Color DarkTurquoise => FromRgba(0x00ced1ff);
-        public static Color DarkViolet => FromRgba(0x9400d3ff);
-        public static Color DeepPink => FromRgba(0xff1493ff);
-        public static Color DeepSkyBlue => FromRgba(0x00bfffff);
-        public static Color DimGray => FromRgba(0x696969ff);
-        public static Color DodgerBlue => FromRgba(0x1e90ffff);
-        public static Color Firebrick => FromRgba(0xb22222ff);
-        public static Color FloralWhite => FromRgba(0xfffaf0ff);
-        public static Color ForestGreen => FromRgba(0x228b22ff);
-        public static Color Fuchsia => FromRgba(0xff00ffff);
-        public static Color Gainsboro => FromRgba(0xdcdcdcff);
-        public static Color GhostWhite => FromRgba(0xf8f8ffff);
-        public static Color Gold => FromRgba(0xffd700ff);
-        public static Color Goldenrod => FromRgba(0xdaa520ff);
-        public static Color Gray => FromRgba(0x808080ff);
-        public static Color Green => FromRgba(0x008000ff);
-        public static Color GreenYellow => FromRgba(0xadff2fff);
-        public static Color Honeydew => FromRgba(0xf0fff0ff);
-        public static Color HotPink => FromRgba(0xff69b4ff);
-        public static Color IndianRed => FromRgba(0xcd5c5cff);
-        public static Color Indigo => FromRgba(0x4b0082ff);
-        public static Color Ivory => FromRgba(0xfffff0ff);
-        public static Color Khaki => FromRgba(0xf0e68cff);
-        public static Color Lavender => FromRgba(0xe6e6faff);
-        public static Color LavenderBlush => FromRgba(0xfff0f5ff);
-        public static Color LawnGreen => FromRgba(0x7cfc00ff);
-        public static Color LemonChiffon => FromRgba(0xfffacdff);
-        public static Color LightBlue => FromRgba(0xadd8e6ff);
-        public static Color LightCoral => FromRgba(0xf08080ff);
-        public static Color LightCyan => FromRgba(0xe0ffffff);
-        public static Color LightGoldenrodYellow => FromRgba(0xfafad2ff);
-        public static Color LightGray => FromRgba(0xd3d3d3ff);
-        public static Color LightGreen => FromRgba(0x90ee90ff);
-        public static Color LightPink => FromRgba(0xffb6c1ff);
-        public static Color LightSalmon => FromRgba(0xffa07aff);
-        public static Color LightSeaGreen => FromRgba(0x20b2aaff);
-        public static Color LightSkyBlue => FromRgba(0x87cefaff);
-        public static Color LightSlateGray => FromRgba(0x778899ff);
-        public static Color LightSteelBlue => FromRgba(0xb0c4deff);
-        public static Color LightYellow => FromRgba(0xffffe0ff);
-        public static Color Lime => FromRgba(0x00ff00ff);
-        public static Color LimeGreen => FromRgba(0x32cd32ff);
-        public static Color Linen => FromRgba(0xfaf0e6ff);
-        public static Color Magenta => FromRgba(0xff00ffff);
-        public static Color Maroon => FromRgba(0x800000ff);
-        public static Color MediumAquamarine => FromRgba(0x66cdaaff);
-        public static Color MediumBlue => FromRgba(0x0000cdff);
-        public static Color MediumOrchid => FromRgba(0xba55d3ff);
-        public static Color MediumPurple => FromRgba(0x9370dbff);
-        public static Color MediumSeaGreen => FromRgba(0x3cb371ff);
-        public static Color MediumSlateBlue => FromRgba(0x7b68eeff);
-        public static Color MediumSpringGreen => FromRgba(0x00fa9aff);
-        public static Color MediumTurquoise => FromRgba(0x48d1ccff);
-        public static Color MediumVioletRed => FromRgba(0xc71585ff);
-        public static Color MidnightBlue => FromRgba(0x191970ff);
-        public static Color MintCream => FromRgba(0xf5fffaff);
-        public static Color MistyRose => FromRgba(0xffe4e1ff);
-        public static Color Moccasin => FromRgba(0xffe4b5ff);
-        public static Color MonoGameOrange => FromRgba(0xe73c00ff);
-        public static Color NavajoWhite => FromRgba(0xffdeadff);
-        public static Color Navy => FromRgba(0x000080ff);
-        public static Color OldLace => FromRgba(0xfdf5e6ff);
-        public static Color Olive => FromRgba(0x808000ff);
-        public static Color OliveDrab => FromRgba(0x6b8e23ff);
-        public static Color Orange => FromRgba(0xffa500ff);
-        public static Color OrangeRed => FromRgba(0xff4500ff);
-        public static Color Orchid => FromRgba(0xda70d6ff);
-        public static Color PaleGoldenrod => FromRgba(0xeee8aaff);
-        public static Color PaleGreen => FromRgba(0x98fb98ff);
-        public static Color PaleTurquoise => FromRgba(0xafeeeeff);
-        public static Color PaleVioletRed => FromRgba(0xdb7093ff);
-        public static Color PapayaWhip => FromRgba(0xffefd5ff);
-        public static Color PeachPuff => FromRgba(0xffdab9ff);
-        public static Color Peru => FromRgba(0xcd853fff);
-        public static Color Pink => FromRgba(0xffc0cbff);
-        public static Color Plum => FromRgba(0xdda0ddff);
-        public static Color PowderBlue => FromRgba(0xb0e0e6ff);
-        public static Color Purple => FromRgba(0x800080ff);
-        public static Color Red => FromRgba(0xff0000ff);
-        public static Color RosyBrown => FromRgba(0xbc8f8fff);
-        public static Color RoyalBlue => FromRgba(0x4169e1ff);
-        public static Color SaddleBrown => FromRgba(0x8b4513ff);
-        public static Color Salmon => FromRgba(0xfa8072ff);
-        public static Color SandyBrown => FromRgba(0xf4a460ff);
-        public static Color SeaGreen => FromRgba(0x2e8b57ff);
-        public static Color SeaShell => FromRgba(0xfff5eeff);
-        public static Color Sienna => FromRgba(0xa0522dff);
-        public static Color Silver => FromRgba(0xc0c0c0ff);
-        public static Color SkyBlue => FromRgba(0x87ceebff);
-        public static Color SlateBlue => FromRgba(0x6a5acdff);
-        public static Color SlateGray => FromRgba(0x708090ff);
-        public static Color Snow => FromRgba(0xfffafaff);
-        public static Color SpringGreen => FromRgba(0x00ff7fff);
-        public static Color SteelBlue => FromRgba(0x4682b4ff);
-        public static Color Tan => FromRgba(0xd2b48cff);
-        public static Color Teal => FromRgba(0x008080ff);
-        public static Color Thistle => FromRgba(0xd8bfd8ff);
-        public static Color Tomato => FromRgba(0xff6347ff);
-        public static Color Turquoise => FromRgba(0x40e0d0ff);
-        public static Color Violet => FromRgba(0xee82eeff);
-        public static Color Wheat => FromRgba(0xf5deb3ff);
-        public static Color White => FromRgba(0xffffffff);
-        public static Color WhiteSmoke => FromRgba(0xf5f5f5ff);
-        public static Color Yellow => FromRgba(0xffff00ff);
-        public static Color YellowGreen => FromRgba(0x9acd32ff);
-    }
+namespace Saladim.Salix;
+
+public partial struct Color
+{
+    public static class Known
+    {
+        public static Color Transparent => FromRgba(0xffffff00);
+        public static Color AliceBlue => FromRgba(0xf0f8ffff);
+        public static Color AntiqueWhite => FromRgba(0xfaebd7ff);
+        public static Color Aqua => FromRgba(0x00ffffff);
+        public static Color Aquamarine => FromRgba(0x7fffd4ff);
+        public static Color Azure => FromRgba(0xf0ffffff);
+        public static Color Beige => FromRgba(0xf5f5dcff);
+        public static Color Bisque => FromRgba(0xffe4c4ff);
+        public static Color Black => FromRgba(0x000000ff);
+        public static Color BlanchedAlmond => FromRgba(0xffebcdff);
+        public static Color Blue => FromRgba(0x0000ffff);
+        public static Color BlueViolet => FromRgba(0x8a2be2ff);
+        public static Color Brown => FromRgba(0xa52a2aff);
+        public static Color BurlyWood => FromRgba(0xdeb887ff);
+        public static Color CadetBlue => FromRgba(0x5f9ea0ff);
+        public static Color Chartreuse => FromRgba(0x7fff00ff);
+        public static Color Chocolate => FromRgba(0xd2691eff);
+        public static Color Coral => FromRgba(0xff7f50ff);
+        public static Color CornflowerBlue => FromRgba(0x6495edff);
+        public static Color Cornsilk => FromRgba(0xfff8dcff);
+        public static Color Crimson => FromRgba(0xdc143cff);
+        public static Color Cyan => FromRgba(0x00ffffff);
+        public static Color DarkBlue => FromRgba(0x00008bff);
+        public static Color DarkCyan => FromRgba(0x008b8bff);
+        public static Color DarkGoldenrod => FromRgba(0xb8860bff);
+        public static Color DarkGray => FromRgba(0xa9a9a9ff);
+        public static Color DarkGreen => FromRgba(0x006400ff);
+        public static Color DarkKhaki => FromRgba(0xbdb76bff);
+        public static Color DarkMagenta => FromRgba(0x8b008bff);
+        public static Color DarkOliveGreen => FromRgba(0x556b2fff);
+        public static Color DarkOrange => FromRgba(0xff8c00ff);
+        public static Color DarkOrchid => FromRgba(0x9932ccff);
+        public static Color DarkRed => FromRgba(0x8b0000ff);
+        public static Color DarkSalmon => FromRgba(0xe9967aff);
+        public static Color DarkSeaGreen => FromRgba(0x8fbc8bff);
+        public static Color DarkSlateBlue => FromRgba(0x483d8bff);
+        public static Color DarkSlateGray => FromRgba(0x2f4f4fff);
+        public static Color DarkTurquoise => FromRgba(0x00ced1ff);
+        public static Color DarkViolet => FromRgba(0x9400d3ff);
+        public static Color DeepPink => FromRgba(0xff1493ff);
+        public static Color DeepSkyBlue => FromRgba(0x00bfffff);
+        public static Color DimGray => FromRgba(0x696969ff);
+        public static Color DodgerBlue => FromRgba(0x1e90ffff);
+        public static Color Firebrick => FromRgba(0xb22222ff);
+        public static Color FloralWhite => FromRgba(0xfffaf0ff);
+        public static Color ForestGreen => FromRgba(0x228b22ff);
+        public static Color Fuchsia => FromRgba(0xff00ffff);
+        public static Color Gainsboro => FromRgba(0xdcdcdcff);
+        public static Color GhostWhite => FromRgba(0xf8f8ffff);
+        public static Color Gold => FromRgba(0xffd700ff);
+        public static Color Goldenrod => FromRgba(0xdaa520ff);
+        public static Color Gray => FromRgba(0x808080ff);
+        public static Color Green => FromRgba(0x008000ff);
+        public static Color GreenYellow => FromRgba(0xadff2fff);
+        public static Color Honeydew => FromRgba(0xf0fff0ff);
+        public static Color HotPink => FromRgba(0xff69b4ff);
+        public static Color IndianRed => FromRgba(0xcd5c5cff);
+        public static Color Indigo => FromRgba(0x4b0082ff);
+        public static Color Ivory => FromRgba(0xfffff0ff);
+        public static Color Khaki => FromRgba(0xf0e68cff);
+        public static Color Lavender => FromRgba(0xe6e6faff);
+        public static Color LavenderBlush => FromRgba(0xfff0f5ff);
+        public static Color LawnGreen => FromRgba(0x7cfc00ff);
+        public static Color LemonChiffon => FromRgba(0xfffacdff);
+        public static Color LightBlue => FromRgba(0xadd8e6ff);
+        public static Color LightCoral => FromRgba(0xf08080ff);
+        public static Color LightCyan => FromRgba(0xe0ffffff);
+        public static Color LightGoldenrodYellow => FromRgba(0xfafad2ff);
+        public static Color LightGray => FromRgba(0xd3d3d3ff);
+        public static Color LightGreen => FromRgba(0x90ee90ff);
+        public static Color LightPink => FromRgba(0xffb6c1ff);
+        public static Color LightSalmon => FromRgba(0xffa07aff);
+        public static Color LightSeaGreen => FromRgba(0x20b2aaff);
+        public static Color LightSkyBlue => FromRgba(0x87cefaff);
+        public static Color LightSlateGray => FromRgba(0x778899ff);
+        public static Color LightSteelBlue => FromRgba(0xb0c4deff);
+        public static Color LightYellow => FromRgba(0xffffe0ff);
+        public static Color Lime => FromRgba(0x00ff00ff);
+        public static Color LimeGreen => FromRgba(0x32cd32ff);
+        public static Color Linen => FromRgba(0xfaf0e6ff);
+        public static Color Magenta => FromRgba(0xff00ffff);
+        public static Color Maroon => FromRgba(0x800000ff);
+        public static Color MediumAquamarine => FromRgba(0x66cdaaff);
+        public static Color MediumBlue => FromRgba(0x0000cdff);
+        public static Color MediumOrchid => FromRgba(0xba55d3ff);
+        public static Color MediumPurple => FromRgba(0x9370dbff);
+        public static Color MediumSeaGreen => FromRgba(0x3cb371ff);
+        public static Color MediumSlateBlue => FromRgba(0x7b68eeff);
+        public static Color MediumSpringGreen => FromRgba(0x00fa9aff);
+        public static Color MediumTurquoise => FromRgba(0x48d1ccff);
+        public static Color MediumVioletRed => FromRgba(0xc71585ff);
+        public static Color MidnightBlue => FromRgba(0x191970ff);
+        public static Color MintCream => FromRgba(0xf5fffaff);
+        public static Color MistyRose => FromRgba(0xffe4e1ff);
+        public static Color Moccasin => FromRgba(0xffe4b5ff);
+        public static Color MonoGameOrange => FromRgba(0xe73c00ff);
+        public static Color NavajoWhite => FromRgba(0xffdeadff);
+        public static Color Navy => FromRgba(0x000080ff);
+        public static Color OldLace => FromRgba(0xfdf5e6ff);
+        public static Color Olive => FromRgba(0x808000ff);
+        public static Color OliveDrab => FromRgba(0x6b8e23ff);
+        public static Color Orange => FromRgba(0xffa500ff);
+        public static Color OrangeRed => FromRgba(0xff4500ff);
+        public static Color Orchid => FromRgba(0xda70d6ff);
+        public static Color PaleGoldenrod => FromRgba(0xeee8aaff);
+        public static Color PaleGreen => FromRgba(0x98fb98ff);
+        public static Color PaleTurquoise => FromRgba(0xafeeeeff);
+        public static Color PaleVioletRed => FromRgba(0xdb7093ff);
+        public static Color PapayaWhip => FromRgba(0xffefd5ff);
+        public static Color PeachPuff => FromRgba(0xffdab9ff);
+        public static Color Peru => FromRgba(0xcd853fff);
+        public static Color Pink => FromRgba(0xffc0cbff);
+        public static Color Plum => FromRgba(0xdda0ddff);
+        public static Color PowderBlue => FromRgba(0xb0e0e6ff);
+        public static Color Purple => FromRgba(0x800080ff);
+        public static Color Red => FromRgba(0xff0000ff);
+        public static Color RosyBrown => FromRgba(0xbc8f8fff);
+        public static Color RoyalBlue => FromRgba(0x4169e1ff);
+        public static Color SaddleBrown => FromRgba(0x8b4513ff);
+        public static Color Salmon => FromRgba(0xfa8072ff);
+        public static Color SandyBrown => FromRgba(0xf4a460ff);
+        public static Color SeaGreen => FromRgba(0x2e8b57ff);
+        public static Color SeaShell => FromRgba(0xfff5eeff);
+        public static Color Sienna => FromRgba(0xa0522dff);
+        public static Color Silver => FromRgba(0xc0c0c0ff);
+        public static Color SkyBlue => FromRgba(0x87ceebff);
+        public static Color SlateBlue => FromRgba(0x6a5acdff);
+        public static Color SlateGray => FromRgba(0x708090ff);
+        public static Color Snow => FromRgba(0xfffafaff);
+        public static Color SpringGreen => FromRgba(0x00ff7fff);
+        public static Color SteelBlue => FromRgba(0x4682b4ff);
+        public static Color Tan => FromRgba(0xd2b48cff);
+        public static Color Teal => FromRgba(0x008080ff);
+        public static Color Thistle => FromRgba(0xd8bfd8ff);
+        public static Color Tomato => FromRgba(0xff6347ff);
+        public static Color Turquoise => FromRgba(0x40e0d0ff);
+        public static Color Violet => FromRgba(0xee82eeff);
+        public static Color Wheat => FromRgba(0xf5deb3ff);
+        public static Color White => FromRgba(0xffffffff);
+        public static Color WhiteSmoke => FromRgba(0xf5f5f5ff);
+        public static Color Yellow => FromRgba(0xffff00ff);
+        public static Color YellowGreen => FromRgba(0x9acd32ff);
+    }
 }
\ No newline at end of file
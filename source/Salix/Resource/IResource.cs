@@ -1,6 +1,6 @@
-﻿namespace Saladim.Salix;
-
-public interface IResource : IDisposable
-{
-    public bool IsDisposed { get; }
-}
+namespace Saladim.Salix;
+
+public interface IResource : IDisposable
+{
+    public bool IsDisposed { get; }
+}
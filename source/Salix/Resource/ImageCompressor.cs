@@ -0,0 +1,53 @@
+namespace Saladim.Salix;
+
+/// <summary>
+/// Compresses decoded images into the block compressed <see cref="ImageFormat"/>s on the CPU,
+/// the output can be uploaded with <see cref="Texture2D.SetData(int, int, ReadOnlySpan{byte}, ImageFormat)"/> as it is.
+/// </summary>
+public static class ImageCompressor
+{
+    /// <summary>Bytes taken by an image of <paramref name="format"/>.</summary>
+    public static int GetDataSize(ImageFormat format, int width, int height)
+        => Texture2D.GetDataSize(format, width, height);
+
+    public static byte[] Compress(ReadOnlySpan<byte> pixels, int width, int height, ImageFormat sourceFormat, ImageFormat targetFormat, CompressionQuality quality = CompressionQuality.Fast)
+    {
+        byte[] blocks = new byte[GetDataSize(targetFormat, width, height)];
+        Compress(pixels, width, height, sourceFormat, blocks, targetFormat, quality);
+        return blocks;
+    }
+
+    public static unsafe void Compress(ReadOnlySpan<byte> pixels, int width, int height, ImageFormat sourceFormat, Span<byte> destination, ImageFormat targetFormat, CompressionQuality quality = CompressionQuality.Fast)
+        => Compress(pixels, width, height, sourceFormat, destination, targetFormat, quality, null, null);
+
+    /// <summary>
+    /// Compress and measure the result, <paramref name="psnr"/> is over the channels <paramref name="targetFormat"/> stores
+    /// (RGB for <see cref="ImageFormat.Bc1"/>, skipping its transparent pixels).
+    /// </summary>
+    public static unsafe void Compress(ReadOnlySpan<byte> pixels, int width, int height, ImageFormat sourceFormat, Span<byte> destination, ImageFormat targetFormat, CompressionQuality quality, out double psnr)
+    {
+        double squaredError;
+        long samples;
+        Compress(pixels, width, height, sourceFormat, destination, targetFormat, quality, &squaredError, &samples);
+        // counted natively, so transparent bc1 pixels and the blocks hanging over the edge are accounted for
+        double meanSquaredError = samples == 0 ? 0 : squaredError / samples;
+        psnr = meanSquaredError == 0 ? double.PositiveInfinity : 10 * Math.Log10(255.0 * 255.0 / meanSquaredError);
+    }
+
+    private static unsafe void Compress(ReadOnlySpan<byte> pixels, int width, int height, ImageFormat sourceFormat, Span<byte> destination, ImageFormat targetFormat, CompressionQuality quality, double* squaredError, long* errorSamples)
+    {
+        if (width <= 0) throw new ArgumentOutOfRangeException(nameof(width));
+        if (height <= 0) throw new ArgumentOutOfRangeException(nameof(height));
+        if (pixels.Length < Texture2D.GetDataSize(sourceFormat, width, height))
+            throw new ArgumentOutOfRangeException(nameof(pixels), SR.TextureRegionOutOfBounds);
+        if (destination.Length < GetDataSize(targetFormat, width, height))
+            throw new ArgumentOutOfRangeException(nameof(destination), SR.TextureRegionOutOfBounds);
+
+        fixed (byte* src = pixels)
+        fixed (byte* dst = destination)
+        {
+            if (Interop.SLX_CompressImage(src, width, height, sourceFormat, targetFormat, quality, dst, destination.Length, squaredError, errorSamples))
+                Interop.Throw();
+        }
+    }
+}
@@ -1,91 +1,151 @@
-﻿using System.Reflection;
-
-namespace Saladim.Salix;
-
-public sealed class ResourceLoader
-{
-    private readonly RenderContext context;
-    private readonly Platform platform;
-
-    public ResourceLoader(Game game)
-    {
-        context = game.RenderContext;
-        platform = game.Platform;
-    }
-
-    private static int VerifyLongValue(long value)
-    {
-        if (value is >= int.MaxValue)
-            throw new NotSupportedException(SR.StreamIsTooLong);
-        if (value is < 0)
-            throw new ArgumentException(SR.InvalidStreamLength, nameof(value));
-        return (int)value;
-    }
-
-    public SpriteFont LoadSpriteFont(Stream streamTexture, Stream streamEntries)
-    {
-        ThrowHelper.ThrowIfNull(streamTexture);
-        ThrowHelper.ThrowIfNull(streamEntries);
-        Texture2D tex = LoadTexture2D(streamTexture);
-        BinaryReader br = new(streamEntries);
-        Dictionary<char, SpriteFont.CharEntry> dic = new();
-        short fontSize = br.ReadInt16();
-        int count = checked((int)streamEntries.Length - 1) / (sizeof(char) + 7 * sizeof(short));
-        for (int i = 0; i < count; i++)
-        {
-            SpriteFont.CharEntry entry = new();
-            char c = (char)br.ReadInt16();
-            entry.X = br.ReadInt16();
-            entry.Y = br.ReadInt16();
-            entry.Width = br.ReadInt16();
-            entry.Height = br.ReadInt16();
-            entry.BearingX = br.ReadInt16();
-            entry.BearingY = br.ReadInt16();
-            entry.Advance = br.ReadInt16();
-            dic[c] = entry;
-        }
-        return new(tex, fontSize, dic);
-    }
-
-    public unsafe Texture2D LoadTexture2D(Stream stream)
-    {
-        ThrowHelper.ThrowIfNull(stream);
-        int length = VerifyLongValue(stream.Length);
-        byte[] bytes = ByteArrayPool.Shared.Rent(length);
-        _ = stream.Read(bytes, 0, length);
-
-        var chunk = platform.LoadImage(new ReadOnlySpan<byte>(bytes, 0, length), out int width, out int height, out ImageFormat format);
-        if (chunk.IsEmpty)
-            throw new ArgumentException(SR.InvalidImageData, nameof(stream));
-        Texture2D texture = new(context, width, height, chunk.Pointer, format);
-        platform.FreeImage(chunk);
-
-        ByteArrayPool.Shared.Return(bytes);
-        return texture;
-    }
-
-    public Shader LoadGlslShader(Stream vertStream, Stream fragStream)
-    {
-        ThrowHelper.ThrowIfNull(vertStream);
-        ThrowHelper.ThrowIfNull(fragStream);
-        int vertLength = VerifyLongValue(vertStream.Length + 1);
-        int fragLength = VerifyLongValue(fragStream.Length + 1);
-        byte[] vertData = ByteArrayPool.Shared.Rent(vertLength);
-        byte[] fragData = ByteArrayPool.Shared.Rent(fragLength);
-        _ = vertStream.Read(vertData, 0, vertLength - 1);
-        _ = fragStream.Read(fragData, 0, fragLength - 1);
-        vertData[vertLength - 1] = 0;
-        fragData[fragLength - 1] = 0;
-
-        Shader? shader;
-        shader = new Shader(context, new ReadOnlySpan<byte>(vertData, 0, vertLength), new(fragData, 0, fragLength));
-
-        ByteArrayPool.Shared.Return(vertData);
-        ByteArrayPool.Shared.Return(fragData);
-        return shader;
-    }
-
-    public static Stream OpenEmbeddedFileStream(string file, Assembly? assembly = null)
-        => (assembly ?? Assembly.GetExecutingAssembly()).GetManifestResourceStream(file)
-            ?? throw new FileNotFoundException(null, file);
+using System.Reflection;
+
+namespace Saladim.Salix;
+
+public sealed class ResourceLoader
+{
+    private readonly RenderContext context;
+    private readonly Platform platform;
+
+    /// <summary>
+    /// When set, textures loaded by <see cref="LoadTexture2D(Stream)"/> no larger than
+    /// <see cref="TextureAtlas.MaxTextureSize"/> are packed into it, so drawing them doesn't break sprite batches.
+    /// </summary>
+    public TextureAtlas? TextureAtlas { get; set; }
+
+    /// <summary>
+    /// When set, decoded images not packed into <see cref="TextureAtlas"/> are compressed to this format
+    /// by <see cref="ImageCompressor"/> before upload, if the driver supports it.
+    /// </summary>
+    public ImageFormat? TextureCompression { get; set; }
+
+    /// <summary>
+    /// When set, <see cref="LoadGlslShader(Stream, Stream)"/> returns before the driver has compiled the shader,
+    /// so loading overlaps with compiling. See <see cref="Shader.IsReady"/>.
+    /// </summary>
+    public bool CompileShadersInBackground { get; set; }
+
+    public ResourceLoader(Game game)
+    {
+        context = game.RenderContext;
+        platform = game.Platform;
+    }
+
+    private static int VerifyLongValue(long value)
+    {
+        if (value is >= int.MaxValue)
+            throw new NotSupportedException(SR.StreamIsTooLong);
+        if (value is < 0)
+            throw new ArgumentException(SR.InvalidStreamLength, nameof(value));
+        return (int)value;
+    }
+
+    public SpriteFont LoadSpriteFont(Stream streamTexture, Stream streamEntries)
+    {
+        ThrowHelper.ThrowIfNull(streamTexture);
+        ThrowHelper.ThrowIfNull(streamEntries);
+        Texture2D tex = LoadTexture2D(streamTexture);
+        BinaryReader br = new(streamEntries);
+        Dictionary<char, SpriteFont.CharEntry> dic = new();
+        short fontSize = br.ReadInt16();
+        int count = checked((int)streamEntries.Length - 1) / (sizeof(char) + 7 * sizeof(short));
+        for (int i = 0; i < count; i++)
+        {
+            SpriteFont.CharEntry entry = new();
+            char c = (char)br.ReadInt16();
+            entry.X = br.ReadInt16();
+            entry.Y = br.ReadInt16();
+            entry.Width = br.ReadInt16();
+            entry.Height = br.ReadInt16();
+            entry.BearingX = br.ReadInt16();
+            entry.BearingY = br.ReadInt16();
+            entry.Advance = br.ReadInt16();
+            dic[c] = entry;
+        }
+        return new(tex, fontSize, dic);
+    }
+
+    /// <summary>
+    /// Load a texture from an image file. KTX2 and DDS containers are uploaded as they are stored,
+    /// keeping their block compression and mip levels, other images are decoded to uncompressed pixels.
+    /// </summary>
+    public unsafe Texture2D LoadTexture2D(Stream stream)
+    {
+        ThrowHelper.ThrowIfNull(stream);
+        int length = VerifyLongValue(stream.Length);
+        byte[] bytes = ByteArrayPool.Shared.Rent(length);
+        _ = stream.Read(bytes, 0, length);
+
+        if (platform.IsImageContainer(new ReadOnlySpan<byte>(bytes, 0, length)))
+        {
+            Texture2D containerTexture = LoadTextureContainer(new ReadOnlySpan<byte>(bytes, 0, length));
+            ByteArrayPool.Shared.Return(bytes);
+            return containerTexture;
+        }
+
+        var chunk = platform.LoadImage(new ReadOnlySpan<byte>(bytes, 0, length), out int width, out int height, out ImageFormat format);
+        if (chunk.IsEmpty)
+            throw new ArgumentException(SR.InvalidImageData, nameof(stream));
+        Texture2D texture;
+        if (TextureAtlas is { } atlas && atlas.CanHold(width, height))
+        {
+            texture = atlas.Add(width, height, chunk.Pointer, format);
+        }
+        else if (TextureCompression is { } compressedFormat && context.IsFormatSupported(compressedFormat))
+        {
+            var pixels = new ReadOnlySpan<byte>(chunk.Pointer, (int)chunk.Size);
+            byte[] blocks = ImageCompressor.Compress(pixels, width, height, format, compressedFormat);
+            texture = new(context, width, height, blocks, compressedFormat);
+        }
+        else
+        {
+            texture = new(context, width, height, chunk.Pointer, format);
+        }
+        platform.FreeImage(chunk);
+
+        ByteArrayPool.Shared.Return(bytes);
+        return texture;
+    }
+
+    private unsafe Texture2D LoadTextureContainer(ReadOnlySpan<byte> data)
+    {
+        var container = platform.ParseImageContainer(data);
+        if (!context.IsFormatSupported(container.format))
+            throw new NotSupportedException(string.Format(SR.ImageFormatNotSupported, container.format));
+
+        Texture2D texture = new(context, container.width, container.height, container.format, container.levels);
+        fixed (byte* ptr = data)
+        {
+            for (int level = 0; level < container.levels; level++)
+                texture.SetLevelData(level, ptr + container.levelOffsets[level]);
+        }
+        if (container.levels > 1)
+            texture.Filter = TextureFilterType.LinearMipmapLinear;
+        return texture;
+    }
+
+    public Shader LoadGlslShader(Stream vertStream, Stream fragStream)
+    {
+        ThrowHelper.ThrowIfNull(vertStream);
+        ThrowHelper.ThrowIfNull(fragStream);
+        int vertLength = VerifyLongValue(vertStream.Length + 1);
+        int fragLength = VerifyLongValue(fragStream.Length + 1);
+        byte[] vertData = ByteArrayPool.Shared.Rent(vertLength);
+        byte[] fragData = ByteArrayPool.Shared.Rent(fragLength);
+        _ = vertStream.Read(vertData, 0, vertLength - 1);
+        _ = fragStream.Read(fragData, 0, fragLength - 1);
+        vertData[vertLength - 1] = 0;
+        fragData[fragLength - 1] = 0;
+
+        Shader? shader;
+        shader = new Shader(context, new ReadOnlySpan<byte>(vertData, 0, vertLength), new(fragData, 0, fragLength), CompileShadersInBackground);
+
+        ByteArrayPool.Shared.Return(vertData);
+        ByteArrayPool.Shared.Return(fragData);
+        return shader;
+    }
+
+    public static Stream OpenEmbeddedFileStream(string file, Assembly? assembly = null)
+        => (assembly ?? Assembly.GetExecutingAssembly()).GetManifestResourceStream(file)
+            ?? throw new FileNotFoundException(null, file);
 }
\ No newline at end of file